@@ -11,6 +11,13 @@
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "GameStats.h"
 using namespace std;
 
 /////////////////////////////////////////////////////////////
@@ -19,6 +26,9 @@ using namespace std;
 
 template <typename T> class Player;
 template <typename T> class Move;
+template <typename T> class BoardView;
+template <typename T> class MoveList;
+template <typename T> class Board;
 
 /////////////////////////////////////////////////////////////
 // Class declarations
@@ -31,7 +41,218 @@ enum class PlayerType {
     HUMAN,     ///< A human player.
     COMPUTER,  ///< A computer-controlled player.
     AI,        ///< An AI player.
-    RANDOM     ///< A Random player.
+    RANDOM,    ///< A Random player.
+    SEARCH     ///< A computer player whose moves come from a MoveStrategy.
+};
+
+/**
+ * @brief How the game stands after a move, from the point of view of the
+ * player who made it (see Board::evaluate_outcome).
+ */
+enum class Outcome {
+    ONGOING, ///< Nobody has won and the game goes on.
+    WIN,     ///< The player who moved has won.
+    LOSS,    ///< The player who moved has lost; the opponent wins.
+    DRAW     ///< The game is over with no winner.
+};
+
+/**
+ * @brief Result of one game played by GameManager in headless mode.
+ */
+struct GameResult {
+    int winner;     ///< Index of the winning player (0 or 1), or -1 for a draw
+    int moves;      ///< Number of moves accepted by the board
+    double seconds; ///< Wall-clock time spent playing the game
+    uint64_t seed;  ///< Seed the game was played from (see GameManager::seed)
+};
+
+/**
+ * @brief Discards everything written to cout while it is alive.
+ *
+ * Headless play uses it so that messages printed from move and board code
+ * never reach the terminal. The previous stream buffer is restored when the
+ * object is destroyed.
+ */
+class SilentOutput {
+    /** @brief Stream buffer that accepts and drops all characters. */
+    struct NullBuffer : public streambuf {
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        streamsize xsputn(const char*, streamsize n) override { return n; }
+    };
+
+    NullBuffer null_buffer; ///< Sink installed into cout
+    streambuf* saved;       ///< cout's buffer before the guard was created
+
+public:
+    /** @brief Redirect cout into the null buffer. */
+    SilentOutput() : saved(cout.rdbuf(&null_buffer)) {}
+
+    /** @brief Restore cout's original buffer. */
+    ~SilentOutput() { cout.rdbuf(saved); }
+};
+
+/**
+ * @brief Small seedable random number engine (SplitMix64).
+ *
+ * Every player and board owns its own engine instead of sharing the global
+ * rand() state, so games running on different threads never contend and a
+ * game can be replayed exactly from its seed. The output sequence is fully
+ * defined here and does not depend on the standard library in use.
+ */
+class RandomEngine {
+    uint64_t state; ///< Current position in the sequence
+
+public:
+    /** @brief Construct an engine starting from seed s. */
+    explicit RandomEngine(uint64_t s = 0) : state(s) {}
+
+    /** @brief Restart the sequence from seed s. */
+    void seed(uint64_t s) { state = s; }
+
+    /** @brief Next 64 random bits. */
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /** @brief Uniform integer in [0, n); n must be positive. */
+    int uniform(int n) {
+        return static_cast<int>(((next() >> 32) * static_cast<uint64_t>(n)) >> 32);
+    }
+
+    /**
+     * @brief Derive an independent seed for sub-stream `stream` of `seed`.
+     *
+     * Used to hand each game, player and board its own seed from a single
+     * session seed.
+     */
+    static uint64_t derive(uint64_t seed, uint64_t stream) {
+        RandomEngine mixer(seed ^ (stream * 0xD1B54A32D192ED03ULL));
+        return mixer.next();
+    }
+};
+
+/**
+ * @brief Random keys for Zobrist hashing of board positions.
+ *
+ * Holds one key per (cell, piece) pair, where a piece is an index into
+ * the board's own symbol alphabet, then `extra` keys for state that is
+ * not on the grid, then one key for the side to move. Keys come from a
+ * fixed SplitMix64 stream, so boards of the same shape built with the
+ * same stream get the same keys, and equal positions hash equally on
+ * different board objects and threads.
+ */
+class ZobristKeys {
+    int columns = 0;       ///< Row stride of the cell keys
+    int pieces = 0;        ///< Size of the symbol alphabet
+    int n_cell_keys = 0;   ///< Number of (cell, piece) keys
+    vector<uint64_t> keys; ///< Cell keys, then extra keys, then the side key
+
+public:
+    /** @brief Empty table, for boards that have not sized theirs yet. */
+    ZobristKeys() {}
+
+    /**
+     * @brief Draw keys for a rows x columns grid.
+     * @param pieces Number of distinct symbols a cell can hold (blank excluded).
+     * @param extra Number of keys for state off the grid.
+     * @param stream Selects a different key sequence, for boards nested in
+     * another board's hash.
+     */
+    ZobristKeys(int rows, int columns, int pieces, int extra = 0, uint64_t stream = 0)
+        : columns(columns), pieces(pieces), n_cell_keys(rows * columns * pieces),
+          keys(n_cell_keys + extra + 1) {
+        RandomEngine gen(RandomEngine::derive(0x5A0B215EEDULL, stream));
+        for (uint64_t& key : keys) key = gen.next();
+    }
+
+    /** @brief Key for `piece` standing in cell (r, c). */
+    uint64_t cell(int r, int c, int piece) const { return keys[(r * columns + c) * pieces + piece]; }
+
+    /** @brief Extra key i, for state that is not on the grid. */
+    uint64_t extra(int i) const { return keys[n_cell_keys + i]; }
+
+    /** @brief Key toggled by every move, so the hash tells whose turn it is. */
+    uint64_t side() const { return keys.back(); }
+};
+
+/**
+ * @brief Contiguous row-major storage for the cells of a board.
+ *
+ * @tparam T Type of the elements stored in the grid.
+ *
+ * All cells live in a single buffer; `grid[r]` returns a pointer to the
+ * start of row r, so `grid[r][c]` is a stride computation rather than a
+ * second heap indirection.
+ */
+template <typename T>
+class Grid {
+    int rows;        ///< Number of rows
+    int columns;     ///< Number of columns (row stride)
+    vector<T> cells; ///< Row-major cell buffer
+
+public:
+    /** @brief Construct a rows x columns grid with every cell set to value. */
+    Grid(int rows, int columns, T value = T())
+        : rows(rows), columns(columns), cells(rows * columns, value) {
+    }
+
+    /** @brief Pointer to the first cell of row r. */
+    T* operator[](int r) { return cells.data() + r * columns; }
+
+    /** @brief Const pointer to the first cell of row r. */
+    const T* operator[](int r) const { return cells.data() + r * columns; }
+
+    /** @brief Set every cell to value. */
+    void fill(T value) { std::fill(cells.begin(), cells.end(), value); }
+
+    /** @brief Get number of rows. */
+    int get_rows() const { return rows; }
+
+    /** @brief Get number of columns (the row stride). */
+    int get_columns() const { return columns; }
+
+    /** @brief Pointer to the underlying row-major buffer. */
+    const T* data() const { return cells.data(); }
+
+    /** @brief Read-only view of the grid that does not copy any cells. */
+    BoardView<T> view() const { return BoardView<T>(cells.data(), rows, columns); }
+};
+
+/**
+ * @brief Read-only, non-owning view of a board's cells.
+ *
+ * @tparam T Type of the elements stored on the board.
+ *
+ * A view is just a pointer plus dimensions, so it is cheap to pass by value.
+ * It stays valid as long as the board it was taken from is alive; cells
+ * changed on the board are visible through the view.
+ */
+template <typename T>
+class BoardView {
+    const T* cells; ///< First cell of the viewed row-major buffer
+    int rows;       ///< Number of rows
+    int columns;    ///< Number of columns (row stride)
+
+public:
+    /** @brief Construct a view over a rows x columns row-major buffer. */
+    BoardView(const T* cells, int rows, int columns)
+        : cells(cells), rows(rows), columns(columns) {
+    }
+
+    /** @brief Pointer to the first cell of row r, so view[r][c] reads a cell. */
+    const T* operator[](int r) const { return cells + r * columns; }
+
+    /** @brief Get number of rows. */
+    int get_rows() const { return rows; }
+
+    /** @brief Get number of columns. */
+    int get_columns() const { return columns; }
+
+    /** @brief True if the view has no cells. */
+    bool empty() const { return rows == 0 || columns == 0; }
 };
 
 /**
@@ -45,17 +266,20 @@ enum class PlayerType {
 template <typename T>
 class Board {
 protected:
-    int rows;        ///< Number of rows
-    int columns;     ///< Number of columns
-    vector<vector<T>> board; ///< 2D vector for the board
-    int n_moves = 0; ///< Number of moves made
+    int rows;         ///< Number of rows
+    int columns;      ///< Number of columns
+    Grid<T> board;    ///< Row-major cell storage, indexed as board[r][c]
+    int n_moves = 0;  ///< Number of moves made
+    RandomEngine rng; ///< Source of randomness for boards with random events
+    ZobristKeys zobrist; ///< Hash keys, sized by each board for its own alphabet
+    uint64_t hash = 0;   ///< Zobrist hash of the current position (see get_hash)
 
 public:
     /**
      * @brief Construct a board with given dimensions.
      */
     Board(int rows, int columns)
-        : rows(rows), columns(columns), board(rows, vector<T>(columns)) {
+        : rows(rows), columns(columns), board(rows, columns) {
     }
 
     /**
@@ -83,10 +307,105 @@ public:
     virtual bool game_is_over(Player<T>*) = 0;
 
     /**
-     * @brief Return a copy of the current board as a 2D vector.
+     * @brief Decide the game once, right after update_board() accepted
+     * `last_move`.
+     *
+     * Gives the same answer as calling is_win(), is_lose() and is_draw()
+     * for the player who moved, in that order, but boards only look at the
+     * lines the move could have changed instead of rescanning everything.
+     * Only valid for the move just applied.
+     *
+     * @param last_move The move update_board() just accepted.
+     * @return The outcome for the player who made `last_move`.
+     */
+    virtual Outcome evaluate_outcome(const Move<T>& last_move) = 0;
+
+    /**
+     * @brief Return the board to its starting position so a new game can be
+     * played on the same object.
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief List every move update_board() would accept from the player
+     * with `symbol` in the current position.
+     *
+     * `moves` is cleared first. The list is not cut short when the game is
+     * over; callers check game_is_over() themselves.
      */
-    vector<vector<T>> get_board_matrix() const {
-        return board;
+    virtual void generate_moves(T symbol, MoveList<T>& moves) = 0;
+
+    /**
+     * @brief Pick one of the moves generate_moves() would list for `symbol`,
+     * uniformly at random.
+     *
+     * Computer players and search playouts call this for every move, so a
+     * board may override it with something cheaper than listing all its
+     * moves, as long as every listed move stays equally likely.
+     *
+     * @return false if the player has no move.
+     */
+    virtual bool random_move(T symbol, RandomEngine& rng, Move<T>& move) {
+        MoveList<T> moves;
+        generate_moves(symbol, moves);
+        if (moves.empty()) return false;
+        move = moves[rng.uniform(moves.size())];
+        return true;
+    }
+
+    /**
+     * @brief Heuristic value of the current position for the player with
+     * `symbol`, used by search engines that stop before the game is decided.
+     *
+     * Positive values favour `symbol`. Values must stay within +-10000 so
+     * they never look like a forced win. The default knows nothing about
+     * the game and returns 0.
+     */
+    virtual int evaluate_position(T /*symbol*/) { return 0; }
+
+    /**
+     * @brief Symbol of the opponent of the player with `symbol`.
+     *
+     * The default swaps 'X' and 'O'; games with other symbols override it.
+     */
+    virtual T other_symbol(T symbol) const {
+        return symbol == static_cast<T>('X') ? static_cast<T>('O') : static_cast<T>('X');
+    }
+
+    /**
+     * @brief A move that is best for `symbol` under perfect play, for boards
+     * small enough to solve outright (see NineCellTable.h).
+     *
+     * @return false if the board has no such table or the game is over.
+     */
+    virtual bool perfect_move(T /*symbol*/, Move<T>& /*move*/) const { return false; }
+
+    /**
+     * @brief Take back the last move applied by update_board(), restoring
+     * everything the move changed.
+     *
+     * Boards keep their own history of applied moves, so search code can
+     * make and unmake moves on one board instead of copying it. reset()
+     * clears the history.
+     *
+     * @return true if a move was undone, false if there was nothing to undo.
+     */
+    virtual bool undo_move() = 0;
+
+    /**
+     * @brief Allocate an independent copy of this board in its current
+     * position, undo history included, so undo_move() works on it too.
+     *
+     * Parallel search gives each thread its own copy to make and unmake
+     * moves on. The caller owns the result.
+     */
+    virtual Board<T>* clone() const = 0;
+
+    /**
+     * @brief Return a read-only view of the current board (no copy is made).
+     */
+    BoardView<T> get_board_view() const {
+        return board.view();
     }
 
     /** @brief Get number of rows. */
@@ -98,6 +417,30 @@ public:
     /** @brief Get number of moves. */
     int get_n_moves() const { return n_moves; }
 
+    /**
+     * @brief 64-bit Zobrist hash of the current position.
+     *
+     * update_board() and undo_move() keep it current by toggling the keys
+     * of whatever they change, and reset() restores the starting value. It
+     * covers the side to move and any state off the grid that affects
+     * later play, so equal hashes mean equal positions, barring collisions.
+     * Boards of the same type and shape agree on every hash.
+     */
+    uint64_t get_hash() const { return hash; }
+
+    /** @brief Reseed the board's random engine. */
+    void seed(uint64_t s) { rng.seed(s); }
+
+    /**
+     * @brief Turn the board's random events (such as Obstacles' obstacles)
+     * on or off; see ChanceFreeSearch.
+     *
+     * The default board has none and ignores the call.
+     *
+     * @return Whether they were on before the call.
+     */
+    virtual bool set_random_events(bool /*enabled*/) { return false; }
+
     /** @brief Return content of cell x, y in current board. */
     T get_cell(int x, int y) {
         return board[x][y];
@@ -109,16 +452,32 @@ public:
  * @brief Represents a single move in a board game.
  *
  * @tparam T Type of symbol placed on the board (e.g., char, int).
+ *
+ * Moves are small values that are returned and passed around by value.
+ * Games that relocate a piece (e.g., 4x4 Tic-Tac-Toe) also record the
+ * cell the piece moves from; for plain placements the origin is (-1, -1).
  */
 template <typename T>
 class Move {
     int x;      ///< Row index
     int y;      ///< Column index
     T symbol;   ///< Symbol used in the move
+    int from_x; ///< Origin row for relocating moves (-1 if none)
+    int from_y; ///< Origin column for relocating moves (-1 if none)
 
 public:
+    /** @brief Construct an empty move at (-1, -1); no board accepts it. */
+    Move() : x(-1), y(-1), symbol(), from_x(-1), from_y(-1) {}
+
     /** @brief Construct a move at (x, y) using a symbol. */
-    Move(int x, int y, T symbol) : x(x), y(y), symbol(symbol) {}
+    Move(int x, int y, T symbol)
+        : x(x), y(y), symbol(symbol), from_x(-1), from_y(-1) {
+    }
+
+    /** @brief Construct a move of a piece from (from_x, from_y) to (x, y). */
+    Move(int from_x, int from_y, int x, int y, T symbol)
+        : x(x), y(y), symbol(symbol), from_x(from_x), from_y(from_y) {
+    }
 
     /** @brief Get row index. */
     int get_x() const { return x; }
@@ -128,6 +487,289 @@ public:
 
     /** @brief Get the move symbol. */
     T get_symbol() const { return symbol; }
+
+    /** @brief Get origin row index (-1 if the move has no origin). */
+    int get_from_x() const { return from_x; }
+
+    /** @brief Get origin column index (-1 if the move has no origin). */
+    int get_from_y() const { return from_y; }
+
+    /** @brief True if both moves place the same symbol from and to the same cells. */
+    bool operator==(const Move& other) const {
+        return x == other.x && y == other.y && symbol == other.symbol
+            && from_x == other.from_x && from_y == other.from_y;
+    }
+
+    /** @brief True if the moves differ in any field. */
+    bool operator!=(const Move& other) const { return !(*this == other); }
+};
+
+//-----------------------------------------------------
+/**
+ * @brief Fixed-capacity list of moves filled by Board::generate_moves().
+ *
+ * @tparam T Type of symbol placed on the board.
+ *
+ * The storage is part of the object, so a list kept on the stack or reused
+ * across calls never touches the heap. Slots are left unconstructed until a
+ * move is added. CAPACITY covers the largest position of any game in this
+ * framework (Word Tic-Tac-Toe's 9 cells x 26 letters).
+ */
+template <typename T>
+class MoveList {
+public:
+    static const int CAPACITY = 256; ///< Maximum number of moves held
+
+private:
+    /** @brief Storage slot that stays unconstructed until add() writes it. */
+    union Slot {
+        Move<T> move;
+        Slot() {}
+    };
+
+    Slot slots[CAPACITY]; ///< Move storage
+    int count = 0;        ///< Number of moves held
+
+public:
+    /** @brief Remove all moves. */
+    void clear() { count = 0; }
+
+    /** @brief Append a move; moves beyond CAPACITY are dropped. */
+    void add(const Move<T>& move) {
+        if (count < CAPACITY) slots[count++].move = move;
+    }
+
+    /** @brief Number of moves held. */
+    int size() const { return count; }
+
+    /** @brief True if the list holds no moves. */
+    bool empty() const { return count == 0; }
+
+    /** @brief Move at index i. */
+    const Move<T>& operator[](int i) const { return slots[i].move; }
+};
+
+//-----------------------------------------------------
+/**
+ * @brief Per-move budget of a search strategy.
+ *
+ * A zero field means no limit. The search stops at whichever limit it
+ * reaches first and plays the best move it has found so far.
+ */
+struct SearchLimits {
+    double seconds; ///< Wall-clock time per move
+    long nodes;     ///< Positions visited (NegamaxEngine) or playouts (MCTSEngine) per move
+
+    /** @brief Limits of `seconds` per move and `nodes` per move. */
+    SearchLimits(double seconds = 0, long nodes = 0) : seconds(seconds), nodes(nodes) {}
+};
+
+/**
+ * @brief Flag that makes a running search return early with its best move
+ * so far.
+ *
+ * Any thread may call cancel(); searches poll cancelled() as they go.
+ */
+class CancelToken {
+    atomic<bool> flag; ///< Set by cancel()
+
+public:
+    /** @brief Construct a token that has not been cancelled. */
+    CancelToken() : flag(false) {}
+
+    /** @brief Ask every search watching this token to stop. */
+    void cancel() { flag.store(true, memory_order_relaxed); }
+
+    /** @brief Clear the flag before the next search. */
+    void reset() { flag.store(false, memory_order_relaxed); }
+
+    /** @brief True once cancel() has been called since the last reset(). */
+    bool cancelled() const { return flag.load(memory_order_relaxed); }
+};
+
+/**
+ * @brief The time limit and cancel token of one search, checked together.
+ *
+ * Created when a search starts; the clock runs from then. Node limits
+ * are counted by each engine itself.
+ */
+class SearchDeadline {
+    chrono::steady_clock::time_point end; ///< When the time limit runs out
+    bool timed;                           ///< False if there is no time limit
+    const CancelToken* token;             ///< Token to watch, or nullptr
+
+public:
+    /** @brief Start the clock for one search under `limits`. */
+    SearchDeadline(const SearchLimits& limits, const CancelToken* token)
+        : end(chrono::steady_clock::now()
+              + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(limits.seconds))),
+          timed(limits.seconds > 0), token(token) {
+    }
+
+    /**
+     * @brief True once the time is up or the search has been cancelled.
+     *
+     * Reads the clock, so engines call it every so many nodes rather than
+     * at every one.
+     */
+    bool passed() const {
+        return (token && token->cancelled()) || (timed && chrono::steady_clock::now() >= end);
+    }
+};
+
+/**
+ * @brief Turns a board's random events off for as long as it is alive.
+ *
+ * Search engines hold one over the board they search. The board's random
+ * engine decides where future random events fall, which a player cannot
+ * know, so a search must not play them out: it plays the game as if they
+ * never happened. The positions it reaches then depend on the moves alone,
+ * as their hashes assume. Copies of the board made while the guard is
+ * alive inherit the setting.
+ */
+template <typename T>
+class ChanceFreeSearch {
+    Board<T>& board; ///< Board being searched
+    bool previous;   ///< Whether its random events were on before
+
+public:
+    /** @brief Turn off the random events of `b`. */
+    explicit ChanceFreeSearch(Board<T>& b) : board(b), previous(b.set_random_events(false)) {}
+
+    /** @brief Turn them back on if they were. */
+    ~ChanceFreeSearch() { board.set_random_events(previous); }
+
+    ChanceFreeSearch(const ChanceFreeSearch&) = delete;
+    ChanceFreeSearch& operator=(const ChanceFreeSearch&) = delete;
+};
+
+//-----------------------------------------------------
+/**
+ * @brief Chooses moves for a computer player without going through a UI.
+ *
+ * @tparam T Type of symbol placed on the board.
+ *
+ * GameManager takes the moves of a player with a strategy attached (see
+ * Player::set_strategy) straight from the strategy, so a search engine
+ * written once plays every game.
+ */
+template <typename T>
+class MoveStrategy {
+protected:
+    SearchLimits limits;                       ///< Budget of each choose_move() call
+    const CancelToken* cancel_token = nullptr; ///< Stops the current choose_move() early, if set
+
+    /**
+     * @brief The opponent's reply the strategy expects to the move its last
+     * choose_move() returned, if it has one; used by ponder().
+     */
+    virtual bool predict_reply(Move<T>& /*reply*/) const { return false; }
+
+private:
+    thread ponder_thread;              ///< Runs the background search while pondering
+    CancelToken ponder_token;          ///< Stops the background search
+    unique_ptr<Board<T>> ponder_board; ///< Copy of the board with the predicted reply played
+
+public:
+    /**
+     * @brief Destroy the strategy. Strategies that ponder must call
+     * stop_pondering() in their own destructor, while their search still
+     * exists.
+     */
+    virtual ~MoveStrategy() { stop_pondering(); }
+
+    /**
+     * @brief Pick a move for the player with `symbol` in the board's current
+     * position. The board must be left in the position it was given in.
+     * @return A move update_board() accepts, or an empty Move if there is none.
+     */
+    virtual Move<T> choose_move(Board<T>& board, T symbol) = 0;
+
+    /** @brief Reseed any randomness the strategy uses; called by Player::seed(). */
+    virtual void seed(uint64_t) {}
+
+    /**
+     * @brief Budget every later choose_move() call to `l`.
+     *
+     * Searching strategies deepen step by step, so whenever the budget runs
+     * out they still have a complete answer to return. Others ignore it.
+     */
+    void set_limits(const SearchLimits& l) { limits = l; }
+
+    /** @brief The per-move budget. */
+    const SearchLimits& get_limits() const { return limits; }
+
+    /**
+     * @brief Watch `token` during choose_move() and return the best move so
+     * far once it is cancelled; nullptr to stop watching.
+     */
+    void set_cancel_token(const CancelToken* token) { cancel_token = token; }
+
+    /**
+     * @brief Think on the opponent's time.
+     *
+     * Plays the reply predict_reply() expects on a copy of `board` and runs
+     * choose_move() on that position in a background thread, without the
+     * per-move budget, until stop_pondering(). Whatever the search keeps
+     * between moves (a transposition table, a tree) then already holds the
+     * answer if the opponent does play that reply. Does nothing if there
+     * is no prediction or it ends the game.
+     *
+     * @param board Current position, with the opponent to move. Not touched.
+     * @param symbol The strategy's own symbol.
+     */
+    void ponder(const Board<T>& board, T symbol) {
+        Move<T> reply;
+        if (ponder_thread.joinable() || !predict_reply(reply)) return;
+        ponder_board.reset(board.clone());
+        ponder_board->set_random_events(false); // the reply must not reveal a random event either
+        if (!ponder_board->update_board(&reply) || ponder_board->evaluate_outcome(reply) != Outcome::ONGOING) {
+            ponder_board.reset();
+            return;
+        }
+        ponder_token.reset();
+        ponder_thread = thread([this, symbol]() {
+            const SearchLimits saved_limits = limits;
+            const CancelToken* saved_token = cancel_token;
+            limits = SearchLimits();
+            cancel_token = &ponder_token;
+            choose_move(*ponder_board, symbol);
+            limits = saved_limits;
+            cancel_token = saved_token;
+        });
+    }
+
+    /**
+     * @brief Stop the background search started by ponder() and wait for it.
+     * Must be called before the next choose_move(); does nothing if the
+     * strategy is not pondering.
+     */
+    void stop_pondering() {
+        if (!ponder_thread.joinable()) return;
+        ponder_token.cancel();
+        ponder_thread.join();
+        ponder_board.reset();
+    }
+};
+
+/**
+ * @brief Plays a uniformly random legal move (see Board::random_move).
+ *
+ * The strategy of every "Computer" player unless its game gives it a
+ * better one.
+ */
+template <typename T>
+class RandomStrategy : public MoveStrategy<T> {
+    RandomEngine rng; ///< Source of the random moves
+
+public:
+    Move<T> choose_move(Board<T>& board, T symbol) override {
+        Move<T> move;
+        board.random_move(symbol, rng, move);
+        return move;
+    }
+
+    void seed(uint64_t s) override { rng.seed(s); }
 };
 
 //-----------------------------------------------------
@@ -141,15 +783,20 @@ class Player {
 protected:
     string name;         ///< Player name
     PlayerType type;     ///< Player type (e.g., HUMAN or COMPUTER)
-    T symbol;            ///< Players symbol on board
+    T symbol;            ///< Player�s symbol on board
     Board<T>* boardPtr;  ///< Pointer to the game board
+    unique_ptr<MoveStrategy<T>> strategy; ///< Picks this player's moves, if set
 
 public:
     /**
      * @brief Construct a player with name, symbol, and type.
+     *
+     * A COMPUTER player starts with a RandomStrategy; UIs may replace it
+     * with their game's own bot.
      */
     Player(string n, T s, PlayerType t)
         : name(n), symbol(s), type(t), boardPtr(nullptr) {
+        if (t == PlayerType::COMPUTER) strategy.reset(new RandomStrategy<T>());
     }
 
     virtual ~Player() {}
@@ -168,6 +815,25 @@ public:
 
     /** @brief Assign the board pointer for the player. */
     void set_board_ptr(Board<T>* b) { boardPtr = b; }
+
+    /** @brief Reseed the player's strategy, if any. */
+    void seed(uint64_t s) {
+        if (strategy) strategy->seed(RandomEngine::derive(s, 1));
+    }
+
+    /** @brief Let `s` pick this player's moves from now on; the player owns it. */
+    void set_strategy(MoveStrategy<T>* s) { strategy.reset(s); }
+
+    /** @brief The strategy picking this player's moves, or nullptr if the UI asks. */
+    MoveStrategy<T>* get_strategy() const { return strategy.get(); }
+
+    /**
+     * @brief The move the player's strategy picks on its board.
+     * @return An empty Move if the player has no strategy (a human) or no move.
+     */
+    Move<T> choose_move() {
+        return strategy ? strategy->choose_move(*boardPtr, symbol) : Move<T>();
+    }
 };
 
 //-----------------------------------------------------
@@ -179,7 +845,14 @@ public:
 template <typename T>
 class UI {
 protected:
-    int cell_width; ///< Width of each displayed board cell
+    int cell_width;        ///< Width of each displayed board cell
+    bool headless = false; ///< True while games are played without a terminal
+
+    /**
+     * @brief Player types offered by setup_players(), in menu order:
+     * HUMAN, COMPUTER, SEARCH, then AI for UIs that add a fourth entry.
+     */
+    vector<string> type_options = { "Human", "Computer", "Search AI" };
 
     /**
      * @brief Ask the user for the player's name.
@@ -193,6 +866,9 @@ protected:
 
     /**
      * @brief Ask the user to choose the player type from a list.
+     *
+     * Entry i of `options` stands for the i-th type of type_options' menu
+     * order. A number outside the list picks HUMAN.
      */
     virtual PlayerType get_player_type_choice(string player_label, const vector<string>& options) {
         cout << "Choose " << player_label << " type:\n";
@@ -200,7 +876,11 @@ protected:
             cout << i + 1 << ". " << options[i] << "\n";
         int choice;
         cin >> choice;
-        return (choice == 2) ? PlayerType::COMPUTER : PlayerType::HUMAN;
+        static const PlayerType types[] = {
+            PlayerType::HUMAN, PlayerType::COMPUTER, PlayerType::SEARCH, PlayerType::AI };
+        if (choice < 1 || choice > 4 || static_cast<size_t>(choice) > options.size())
+            return PlayerType::HUMAN;
+        return types[choice - 1];
     }
 
 public:
@@ -223,9 +903,19 @@ public:
     virtual void display_message(string message) { cout << message << "\n"; }
 
     /**
-     * @brief Ask the user (or AI) to make a move.
+     * @brief Switch headless mode on or off.
+     *
+     * In headless mode a UI must not clear the screen, pause, or wait for
+     * anything other than a HUMAN player's input.
      */
-    virtual Move<T>* get_move(Player<T>*) = 0;
+    void set_headless(bool on) { headless = on; }
+
+    /**
+     * @brief Ask a human player for a move. Computer players never come
+     * here: GameManager takes their moves from their strategy.
+     * @return The chosen move, by value.
+     */
+    virtual Move<T> get_move(Player<T>*) = 0;
 
     /**
      * @brief Set up players for the game.
@@ -241,11 +931,11 @@ public:
      * @brief Display the current board matrix in formatted form.
      */
 
-    virtual void display_board_matrix(const vector<vector<T>>& matrix) const {
-        if (matrix.empty() || matrix[0].empty()) return;
+    virtual void display_board_matrix(const BoardView<T>& matrix) const {
+        if (matrix.empty()) return;
 
-        int rows = matrix.size();
-        int cols = matrix[0].size();
+        int rows = matrix.get_rows();
+        int cols = matrix.get_columns();
 
         cout << "\n    ";
         for (int j = 0; j < cols; ++j)
@@ -273,50 +963,218 @@ class GameManager {
     Board<T>* boardPtr;    ///< Game board
     Player<T>* players[2]; ///< Two players
     UI<T>* ui;             ///< User interface
+    uint64_t game_seed;    ///< Seed the board and players were last seeded from
+    CancelToken cancel_token; ///< Handed to the strategy searching the current move
+    GameStats stats;       ///< Turn timings; empty unless built with BOARDGAME_STATS
+
+    /** @brief Take the player's move from its strategy, or from the UI if it has none. */
+    Move<T> next_move(Player<T>* player) {
+        GameStats::Timer timer = stats.time(GameStats::DECISION);
+        if (MoveStrategy<T>* strategy = player->get_strategy()) {
+            cancel_token.reset();
+            strategy->set_cancel_token(&cancel_token);
+            Move<T> move = player->choose_move();
+            strategy->set_cancel_token(nullptr);
+            return move;
+        }
+        return ui->get_move(player);
+    }
+
+    /** @brief Play `move` on the board, counting it if the board turns it down. */
+    bool apply(Move<T>& move) {
+        GameStats::Timer timer = stats.time(GameStats::UPDATE);
+        if (boardPtr->update_board(&move)) return true;
+        stats.count_rejected();
+        return false;
+    }
+
+    /** @brief Board::evaluate_outcome(), timed. */
+    Outcome outcome_of(const Move<T>& move) {
+        GameStats::Timer timer = stats.time(GameStats::WIN_CHECK);
+        return boardPtr->evaluate_outcome(move);
+    }
+
+    /** @brief Show the board, timed. */
+    void render() {
+        GameStats::Timer timer = stats.time(GameStats::RENDER);
+        ui->display_board_matrix(boardPtr->get_board_view());
+    }
+
+    /** @brief Show the end-of-game message, timed as rendering. */
+    void announce(const string& message) {
+        GameStats::Timer timer = stats.time(GameStats::RENDER);
+        ui->display_message(message);
+    }
 
 public:
     /**
      * @brief Construct a game manager with board, players, and UI.
+     *
+     * The board and players are seeded from `seed`; the same seed and the
+     * same moves always reproduce the same game.
      */
-    GameManager(Board<T>* b, Player<T>* p[2], UI<T>* u)
+    GameManager(Board<T>* b, Player<T>* p[2], UI<T>* u, uint64_t seed = 0)
         : boardPtr(b), ui(u) {
         players[0] = p[0];
         players[1] = p[1];
         players[0]->set_board_ptr(b);
         players[1]->set_board_ptr(b);
+        this->seed(seed);
+    }
+
+    /**
+     * @brief Seed the board and both players from one game seed.
+     *
+     * Each of them gets its own derived sub-seed, so no two engines in a
+     * game produce the same sequence.
+     */
+    void seed(uint64_t s) {
+        game_seed = s;
+        boardPtr->seed(RandomEngine::derive(s, 0));
+        players[0]->seed(RandomEngine::derive(s, 1));
+        players[1]->seed(RandomEngine::derive(s, 2));
     }
 
+    /**
+     * @brief Make the strategy searching the current move stop and play its
+     * best move so far. Safe to call from any thread; does nothing between
+     * searches.
+     */
+    void cancel_search() { cancel_token.cancel(); }
+
     /**
      * @brief Run the main game loop until someone wins or the game ends.
+     *
+     * While a human player is deciding, an opponent with a strategy ponders
+     * (see MoveStrategy::ponder) on the reply it expects. In a build with
+     * BOARDGAME_STATS, the game's turn timings are printed to cerr at the
+     * end.
      */
     void run() {
-        ui->display_board_matrix(boardPtr->get_board_matrix());
+        stats.reset();
+        render();
         Player<T>* currentPlayer = players[0];
+        bool over = false;
 
-        while (true) {
+        while (!over) {
             for (int i : {0, 1}) {
                 currentPlayer = players[i];
-                Move<T>* move = ui->get_move(currentPlayer);
+                MoveStrategy<T>* ponderer = nullptr;
+                if (currentPlayer->get_type() == PlayerType::HUMAN) {
+                    ponderer = players[1 - i]->get_strategy();
+                    if (ponderer) ponderer->ponder(*boardPtr, players[1 - i]->get_symbol());
+                }
+                Move<T> move = next_move(currentPlayer);
 
-                while (!boardPtr->update_board(move))
-                    move = ui->get_move(currentPlayer);
+                while (!apply(move))
+                    move = next_move(currentPlayer);
+                if (ponderer) ponderer->stop_pondering();
 
-                ui->display_board_matrix(boardPtr->get_board_matrix());
+                render();
 
-                if (boardPtr->is_win(currentPlayer)) {
-                    ui->display_message(currentPlayer->get_name() + " wins!");
-                    return;
-                }
-                if (boardPtr->is_lose(currentPlayer)) {
-                    ui->display_message(players[1 - i]->get_name() + " wins!");
-                    return;
+                Outcome outcome = outcome_of(move);
+                if (outcome == Outcome::WIN)
+                    announce(currentPlayer->get_name() + " wins!");
+                else if (outcome == Outcome::LOSS)
+                    announce(players[1 - i]->get_name() + " wins!");
+                else if (outcome == Outcome::DRAW)
+                    announce("Draw!");
+                if (outcome != Outcome::ONGOING) {
+                    over = true;
+                    break;
                 }
-                if (boardPtr->is_draw(currentPlayer)) {
-                    ui->display_message("Draw!");
-                    return;
+            }
+        }
+        stats.count_game();
+        stats.print(cerr);
+    }
+
+    /**
+     * @brief Play one game from the board's current position without rendering.
+     *
+     * Same turn order and end-of-game checks as run(), but nothing is
+     * displayed and the outcome is returned instead of printed. The board is
+     * not reset first and cout is not silenced; run_batch() does both.
+     * To replay a game, call seed() with its recorded seed, reset the
+     * board, then call play_headless() again. Turn timings add up over
+     * calls; see get_stats().
+     *
+     * @return Winner index (-1 for a draw), accepted move count, wall time
+     * and the seed in effect.
+     */
+    GameResult play_headless() {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        GameResult result = { -1, 0, 0.0, game_seed };
+        bool over = false;
+
+        while (!over) {
+            for (int i : {0, 1}) {
+                Player<T>* currentPlayer = players[i];
+                Move<T> move = next_move(currentPlayer);
+
+                while (!apply(move))
+                    move = next_move(currentPlayer);
+                result.moves++;
+
+                Outcome outcome = outcome_of(move);
+                if (outcome == Outcome::WIN)
+                    result.winner = i;
+                else if (outcome == Outcome::LOSS)
+                    result.winner = 1 - i;
+                if (outcome != Outcome::ONGOING) {
+                    over = true;
+                    break;
                 }
             }
         }
+
+        stats.count_game();
+        result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    /**
+     * @brief Turn timings of the games played since the last run() or
+     * run_batch(); empty unless built with BOARDGAME_STATS.
+     */
+    const GameStats& get_stats() const { return stats; }
+
+    /**
+     * @brief Play n_games back-to-back with no terminal I/O.
+     *
+     * The board is reset before every game and everything printed to cout
+     * is discarded while the batch runs. Game g is seeded with
+     * RandomEngine::derive(seed, g), so any single game can be replayed from
+     * the seed stored in its result. Both players must be non-human, since
+     * nobody is there to type a move. In a build with BOARDGAME_STATS, the
+     * turn timings of the whole batch are printed to cerr at the end.
+     *
+     * @param n_games Number of games to play.
+     * @param seed Session seed the per-game seeds are derived from.
+     * @return One GameResult per game, or an empty vector if a player is human.
+     */
+    vector<GameResult> run_batch(int n_games, uint64_t seed = 0) {
+        vector<GameResult> results;
+        for (int i : {0, 1}) {
+            if (players[i]->get_type() == PlayerType::HUMAN) {
+                cerr << "Batch mode needs computer players, but "
+                    << players[i]->get_name() << " is human.\n";
+                return results;
+            }
+        }
+
+        results.reserve(n_games);
+        stats.reset();
+        SilentOutput silence;
+        ui->set_headless(true);
+        for (int g = 0; g < n_games; ++g) {
+            this->seed(RandomEngine::derive(seed, g));
+            boardPtr->reset();
+            results.push_back(play_headless());
+        }
+        ui->set_headless(false);
+        stats.print(cerr);
+        return results;
     }
 };
 
@@ -327,7 +1185,6 @@ public:
 template <typename T>
 Player<T>** UI<T>::setup_players() {
     Player<T>** players = new Player<T>*[2];
-    vector<string> type_options = { "Human", "Computer" };
 
     string nameX = get_player_name("Player X");
     PlayerType typeX = get_player_type_choice("Player X", type_options);
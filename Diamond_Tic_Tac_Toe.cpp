@@ -1,12 +1,35 @@
 #include "Diamond_Tic_Tac_Toe.h"
+#include "WinLines.h"
 #include <iostream>
 using namespace std;
 
+/** @brief Mask of the 25 playable cells: |r - 3| + |c - 3| <= 3. */
+static constexpr uint64_t diamond_cells() {
+    uint64_t mask = 0;
+    for (int r = 0; r < 7; r++)
+        for (int c = 0; c < 7; c++)
+            if ((r < 3 ? 3 - r : r - 3) + (c < 3 ? 3 - c : c - 3) <= 3)
+                mask |= uint64_t(1) << (r * 7 + c);
+    return mask;
+}
+
+// Every four-in-a-row inside the diamond, as masks over marks_of()
+static constexpr WinLines<7, 7, 4, diamond_cells()> diamond_lines;
+
 
 Diamond_Tic_Tac_Toe_Board::Diamond_Tic_Tac_Toe_Board()
-    : Board(7, 7)
+    : XOBoardBase(7, 7)
 {
-    board.resize(7, vector<char>(7, '#'));
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void Diamond_Tic_Tac_Toe_Board::reset() {
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    history.clear();
+    board.fill('#');
 
     int mid = 3;
     for (int r = 0; r < 7; r++) {
@@ -19,6 +42,14 @@ Diamond_Tic_Tac_Toe_Board::Diamond_Tic_Tac_Toe_Board()
     }
 }
 
+void Diamond_Tic_Tac_Toe_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == ' ')
+                moves.add(Move<char>(i, j, symbol));
+}
+
 
 bool Diamond_Tic_Tac_Toe_Board::inside_diamond(int r, int c) {
     int mid = 3;
@@ -43,40 +74,26 @@ bool Diamond_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
 
     board[r][c] = s;
     n_moves++;
+    hash_xo_move(r, c, s);
+    history.push_back({ r, c });
     return true;
 }
 
+bool Diamond_Tic_Tac_Toe_Board::undo_move() {
+    if (history.empty()) return false;
 
-
-bool Diamond_Tic_Tac_Toe_Board::check_line(char sym, int r, int c, int dr, int dc, int needed) {
-    for (int i = 0; i < needed; i++) {
-        int rr = r + dr * i;
-        int cc = c + dc * i;
-
-        if (rr < 0 || rr >= 7 || cc < 0 || cc >= 7) return false;
-        if (!inside_diamond(rr, cc)) return false;
-        if (board[rr][cc] != sym) return false;
-    }
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = ' ';
+    n_moves--;
     return true;
 }
 
 
 
 bool Diamond_Tic_Tac_Toe_Board::is_win(Player<char>* player) {
-    char sym = player->get_symbol();
-
-    for (int r = 0; r < 7; r++) {
-        for (int c = 0; c < 7; c++) {
-            if (!inside_diamond(r, c)) continue;
-
-            if (check_line(sym, r, c, 1, 0, 4) ||
-                check_line(sym, r, c, 0, 1, 4) ||
-                check_line(sym, r, c, 1, 1, 4) ||
-                check_line(sym, r, c, 1, -1, 4))
-                return true;
-        }
-    }
-    return false;
+    return diamond_lines.any(marks_of(player->get_symbol()));
 }
 
 
@@ -88,22 +105,29 @@ bool Diamond_Tic_Tac_Toe_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome Diamond_Tic_Tac_Toe_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (diamond_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return n_moves == 25 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 
 
-Move<char>* Diamond_AI_Player::get_ai_move() {
-    auto mat = boardPtr->get_board_matrix();
+Move<char> Diamond_FirstCellStrategy::choose_move(Board<char>& board, char symbol) {
+    BoardView<char> mat = board.get_board_view();
 
     for (int r = 0; r < 7; r++)
         for (int c = 0; c < 7; c++)
             if (mat[r][c] == ' ' && abs(r - 3) + abs(c - 3) <= 3)
-                return new Move<char>(r, c, symbol);
+                return Move<char>(r, c, symbol);
 
-    return nullptr;
+    return Move<char>();
 }
 
 
 
-void Diamond_Tic_Tac_Toe_UI::display_board_matrix(const vector<vector<char>>& mat) const {
+void Diamond_Tic_Tac_Toe_UI::display_board_matrix(const BoardView<char>& mat) const {
     system("cls");
     cout << "\n       ? DIAMOND TIC TAC TOE ?\n\n";
 
@@ -2,7 +2,7 @@
  * @file Diamond_Tic_Tac_Toe.h
  * @brief Defines classes for Diamond-shaped Tic-Tac-Toe game variant.
  *
- * This file contains the board, AI player, and UI classes for a unique
+ * This file contains the board, computer strategy, and UI classes for a unique
  * diamond-shaped Tic-Tac-Toe game played on a 7x7 grid where only
  * diamond-shaped cells are playable.
  *
@@ -14,6 +14,7 @@
 #define DIAMOND_TIC_TAC_TOE_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 #include <iostream>
 #include <vector>
 using namespace std;
@@ -40,7 +41,7 @@ using namespace std;
  *
  * @see Board
  */
-class Diamond_Tic_Tac_Toe_Board : public Board<char> {
+class Diamond_Tic_Tac_Toe_Board final : public XOBoardBase {
 public:
     /**
      * @brief Constructs a 7x7 diamond-shaped board.
@@ -99,6 +100,41 @@ public:
      */
     bool game_is_over(Player<char>* player) override;
 
+    /**
+     * @brief Checks only the four lines through the cell just filled.
+     *
+     * Cells outside the diamond hold '#', so a run never leaves the
+     * playable area.
+     *
+     * @param last_move The move just applied
+     * @return WIN for 4 in a row, DRAW once all 25 cells are filled, else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to an empty diamond.
+     *
+     * Re-marks cells outside the diamond with '#', clears the playable
+     * cells and resets the move counter.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new Diamond_Tic_Tac_Toe_Board(*this); }
+
+    /**
+     * @brief Lists every empty cell inside the diamond.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
     /**
      * @brief Checks if a cell is inside the diamond shape.
      *
@@ -112,48 +148,28 @@ public:
     bool inside_diamond(int r, int c);
 
 private:
-    /**
-     * @brief Checks for a line of matching symbols in a specific direction.
-     *
-     * @param sym Symbol to check for
-     * @param r Starting row
-     * @param c Starting column
-     * @param dr Row direction (-1, 0, or 1)
-     * @param dc Column direction (-1, 0, or 1)
-     * @param needed Number of consecutive symbols needed
-     * @return true if line of required length found, false otherwise
-     */
-    bool check_line(char sym, int r, int c, int dr, int dc, int needed);
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 };
 
 /**
- * @class Diamond_AI_Player
- * @brief AI player implementation for Diamond Tic-Tac-Toe.
+ * @class Diamond_FirstCellStrategy
+ * @brief Strategy of the Diamond Tic-Tac-Toe computer and AI players.
  *
- * Simple AI that selects the first available cell within the diamond
- * shape, prioritizing cells closer to the center.
+ * Simple bot that selects the first available cell within the diamond
+ * shape.
  *
- * @see Player
+ * @see MoveStrategy
  */
-class Diamond_AI_Player : public Player<char> {
+class Diamond_FirstCellStrategy : public MoveStrategy<char> {
 public:
     /**
-     * @brief Constructs an AI player.
+     * @brief Generates a computer move.
      *
-     * @param n Player name
-     * @param s Player symbol ('X' or 'O')
-     */
-    Diamond_AI_Player(string n, char s) : Player<char>(n, s, PlayerType::AI) {}
-
-    /**
-     * @brief Generates an AI move.
+     * Searches the diamond row by row for the first empty cell.
      *
-     * Searches for the first empty cell within the diamond shape,
-     * starting from positions closer to the center (row 3, col 3).
-     *
-     * @return Pointer to Move object, or nullptr if no valid moves
+     * @return Move object, or a default (-1, -1) Move if no cell is free
      */
-    Move<char>* get_ai_move();
+    Move<char> choose_move(Board<char>& board, char symbol) override;
 };
 
 /**
@@ -173,23 +189,19 @@ public:
     Diamond_Tic_Tac_Toe_UI() : UI<char>("\n--- Diamond Tic Tac Toe ---", 2) {}
 
     /**
-     * @brief Gets a move from a player.
+     * @brief Gets a move from a human player.
      *
-     * For human players, prompts for row and column input.
-     * For AI players, calls the AI's move generation method.
+     * Prompts for row and column input.
      *
      * @param player Pointer to player making the move
-     * @return Pointer to Move object representing the player's move
+     * @return Move object representing the player's move
      */
-    Move<char>* get_move(Player<char>* player) override {
-        if (player->get_type() == PlayerType::AI)
-            return dynamic_cast<Diamond_AI_Player*>(player)->get_ai_move();
-
+    Move<char> get_move(Player<char>* player) override {
         int r, c;
         cout << player->get_name() << " (" << player->get_symbol()
             << ") enter row and column: ";
         cin >> r >> c;
-        return new Move<char>(r, c, player->get_symbol());
+        return Move<char>(r, c, player->get_symbol());
     }
 
     /**
@@ -197,14 +209,15 @@ public:
      *
      * @param name Player name
      * @param symbol Player symbol
-     * @param type Player type (HUMAN or AI)
+     * @param type Player type; COMPUTER and AI players use
+     * Diamond_FirstCellStrategy
      * @return Pointer to created Player object
      */
     Player<char>* create_player(string& name, char symbol, PlayerType type) override {
+        Player<char>* player = new Player<char>(name, symbol, type);
         if (type == PlayerType::AI || type == PlayerType::COMPUTER)
-            return new Diamond_AI_Player(name, symbol);
-
-        return new Player<char>(name, symbol, PlayerType::HUMAN);
+            player->set_strategy(new Diamond_FirstCellStrategy());
+        return player;
     }
 
     /**
@@ -215,7 +228,7 @@ public:
      *
      * @param mat The board matrix to display
      */
-    void display_board_matrix(const vector<vector<char>>& mat) const;
+    void display_board_matrix(const BoardView<char>& mat) const override;
 };
 
 #endif // DIAMOND_TIC_TAC_TOE_H
\ No newline at end of file
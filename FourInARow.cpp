@@ -1,14 +1,32 @@
 #include "FourInARow.h"
+#include "WinLines.h"
 #include <iostream>
 #include <cctype>
 
 using namespace std;
 
-FourInARow_Board::FourInARow_Board() : Board<char>(6, 7) {
-    for (auto& row : board) {
-        for (auto& cell : row) {
-            cell = blank_symbol;
-        }
+// Every four-in-a-row of the 6x7 grid, as masks over marks_of()
+static constexpr WinLines<6, 7, 4> four_lines;
+
+FourInARow_Board::FourInARow_Board() : XOBoardBase(6, 7) {
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void FourInARow_Board::reset() {
+    board.fill(blank_symbol);
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    history.clear();
+}
+
+void FourInARow_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int col = 0; col < columns; ++col) {
+        int row = find_lowest_row(col);
+        if (row != -1)
+            moves.add(Move<char>(row, col, symbol));
     }
 }
 
@@ -39,58 +57,25 @@ bool FourInARow_Board::update_board(Move<char>* move) {
 
     board[row][col] = mark;
     n_moves++;
+    hash_xo_move(row, col, mark);
+    history.push_back({ row, col });
 
     return true;
 }
 
-bool FourInARow_Board::is_win(Player<char>* player) {
-    const char sym = toupper(player->get_symbol());
-
-    for (int r = 0; r < rows; r++) {
-        for (int c = 0; c <= columns - 4; c++) {
-            if (board[r][c] == sym &&
-                board[r][c + 1] == sym &&
-                board[r][c + 2] == sym &&
-                board[r][c + 3] == sym) {
-                return true;
-            }
-        }
-    }
-
-    for (int c = 0; c < columns; c++) {
-        for (int r = 0; r <= rows - 4; r++) {
-            if (board[r][c] == sym &&
-                board[r + 1][c] == sym &&
-                board[r + 2][c] == sym &&
-                board[r + 3][c] == sym) {
-                return true;
-            }
-        }
-    }
-
-    for (int r = 0; r <= rows - 4; r++) {
-        for (int c = 0; c <= columns - 4; c++) {
-            if (board[r][c] == sym &&
-                board[r + 1][c + 1] == sym &&
-                board[r + 2][c + 2] == sym &&
-                board[r + 3][c + 3] == sym) {
-                return true;
-            }
-        }
-    }
+bool FourInARow_Board::undo_move() {
+    if (history.empty()) return false;
 
-    for (int r = 0; r <= rows - 4; r++) {
-        for (int c = 3; c < columns; c++) {
-            if (board[r][c] == sym &&
-                board[r + 1][c - 1] == sym &&
-                board[r + 2][c - 2] == sym &&
-                board[r + 3][c - 3] == sym) {
-                return true;
-            }
-        }
-    }
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
 
-    return false;
+bool FourInARow_Board::is_win(Player<char>* player) {
+    return four_lines.any(marks_of(toupper(player->get_symbol())));
 }
 
 bool FourInARow_Board::is_draw(Player<char>* player) {
@@ -101,6 +86,15 @@ bool FourInARow_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome FourInARow_Board::evaluate_outcome(const Move<char>& /*last_move*/) {
+    // The move only carries a column; the landing row is in the history
+    const pair<int, int>& cell = history.back();
+
+    if (four_lines.completes(cell.first, cell.second, marks_of(board[cell.first][cell.second])))
+        return Outcome::WIN;
+    return n_moves >= rows * columns ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 FourInARow_UI::FourInARow_UI()
     : UI<char>("Welcome to FCAI Four-in-a-Row (Connect Four) Game!", 3) {
     cout << "\n=== This is Basem's gamecc ===" << endl;
@@ -119,44 +113,22 @@ Player<char>* FourInARow_UI::create_player(string& name, char symbol, PlayerType
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* FourInARow_UI::get_move(Player<char>* player) {
+Move<char> FourInARow_UI::get_move(Player<char>* player) {
     int col;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\n" << player->get_name() << " (" << player->get_symbol()
-            << "), enter column number (0-6): ";
-
-        cin >> col;
+    cout << "\n" << player->get_name() << " (" << player->get_symbol()
+        << "), enter column number (0-6): ";
 
-        while (cin.fail() || col < 0 || col >= 7) {
-            cin.clear();
-            cin.ignore(1000, '\n');
-            cout << "Invalid! Enter a column number between 0-6: ";
-            cin >> col;
-        }
+    cin >> col;
 
+    while (cin.fail() || col < 0 || col >= 7) {
+        cin.clear();
         cin.ignore(1000, '\n');
+        cout << "Invalid! Enter a column number between 0-6: ";
+        cin >> col;
     }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        FourInARow_Board* board = dynamic_cast<FourInARow_Board*>(player->get_board_ptr());
-
-        int attempts = 0;
-        do {
-            col = rand() % 7;
-            attempts++;
-            if (attempts > 50) {
-                for (int c = 0; c < 7; c++) {
-                    if (board->get_board_matrix()[5][c] == '.') {
-                        col = c;
-                        break;
-                    }
-                }
-                break;
-            }
-        } while (board->get_board_matrix()[5][col] != '.');
-
-        cout << "\nComputer " << player->get_name() << " chooses column " << col << endl;
-    }
 
-    return new Move<char>(0, col, player->get_symbol());
+    cin.ignore(1000, '\n');
+
+    return Move<char>(0, col, player->get_symbol());
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #define FOUR_IN_A_ROW_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 
 using namespace std;
 
@@ -35,9 +36,10 @@ using namespace std;
  *
  * @see Board
  */
-class FourInARow_Board : public Board<char> {
+class FourInARow_Board final : public XOBoardBase {
 private:
     char blank_symbol = '.'; ///< Character representing empty cells
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 
     /**
      * @brief Finds the lowest empty row in a column.
@@ -109,6 +111,39 @@ public:
      * @return true if game is won or drawn, false otherwise
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Checks only the four lines through the piece just dropped.
+     *
+     * The landing row is taken from the move history, since a move only
+     * names its column.
+     *
+     * @param last_move The move just applied
+     * @return WIN for 4 in a row, DRAW once all 42 cells are filled, else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to an empty 6×7 grid.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new FourInARow_Board(*this); }
+
+    /**
+     * @brief Lists every column that is not full, as a move to
+     * the row the piece would land on.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 };
 
 /**
@@ -149,20 +184,15 @@ public:
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a move from a player.
+     * @brief Gets a move from a human player.
      *
-     * For human players:
      * - Prompts for column number (0-6)
      * - Validates input is a valid integer in range
      *
-     * For computer players:
-     * - Randomly selects an available column
-     * - Uses fallback search if random selection fails
-     *
      * @param player Pointer to player making the move
-     * @return Pointer to Move object with column in y-coordinate
+     * @return Move object with column in y-coordinate
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif // FOUR_IN_A_ROW_H
\ No newline at end of file
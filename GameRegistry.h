@@ -0,0 +1,244 @@
+/**
+ * @file GameRegistry.h
+ * @brief Every game variant behind one list of factories.
+ *
+ * This file provides:
+ * - `GameOptions`: How to play a variant from the command line: the two
+ *   players' engines, the number of games, worker threads, seed and
+ *   verbosity.
+ * - `GameEntry`: One variant: its command-line name, its menu title, the
+ *   two ways of playing it and its move-tree counts (see Perft.h).
+ * - `make_game_entry`: Builds a GameEntry from a variant's board and UI
+ *   classes, player symbols and computer-player setup.
+ * - `GameRegistry`: The variants in menu order, looked up by name.
+ * - `parse_player_type`: Maps an engine name (human, computer, search, ai)
+ *   to its PlayerType.
+ *
+ * Main_Menu.cpp registers each variant once; the interactive menu and the
+ * command line both play from the registry.
+ */
+
+#ifndef GAME_REGISTRY_H
+#define GAME_REGISTRY_H
+
+#include <iostream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "BoardGame_Classes.h"
+#include "Tournament.h"
+#include "Perft.h"
+
+using namespace std;
+
+/**
+ * @brief How to play a variant without menus.
+ */
+struct GameOptions {
+    PlayerType players[2] = { PlayerType::COMPUTER, PlayerType::COMPUTER }; ///< Engines of players 1 and 2
+    long games = 1;      ///< Games to play
+    int threads = 0;     ///< Tournament worker threads; 0 uses every hardware thread
+    uint64_t seed = 0;   ///< Seed of the game, or of the tournament
+    bool quiet = false;  ///< Print only the summary line, even for a single game
+    int perft = 0;       ///< If set, count the move tree to this depth instead of playing
+};
+
+/**
+ * @brief One game variant, ready to be played from the menu or the
+ * command line.
+ */
+struct GameEntry {
+    string name;   ///< Name given to --game
+    string title;  ///< Menu text
+
+    /** @brief Ask for the players on stdin and play one game on the terminal. */
+    function<void(uint64_t seed)> play_interactive;
+
+    /**
+     * @brief Play as `options` says. A single game that is not quiet is shown
+     * on the terminal; anything else runs as a Tournament and prints one
+     * summary line.
+     * @return Process exit code: 0 on success, 1 if the options do not fit
+     * the game.
+     */
+    function<int(const GameOptions& options)> play;
+
+    /**
+     * @brief parallel_perft() from the starting position, on `threads`
+     * workers, with the board seeded from `seed`.
+     */
+    function<uint64_t(int depth, int threads, uint64_t seed)> perft;
+
+    /**
+     * @brief Known-good perft counts from the starting position: entry k
+     * is depth k + 1. Empty for games whose tree depends on the seed.
+     */
+    vector<uint64_t> perft_counts;
+};
+
+/**
+ * @brief Gives a freshly created player the engine its game uses for it.
+ *
+ * Called for both players of every game, after UI::create_player(). The
+ * second argument is how many threads one search may use: all of them
+ * for a game on the terminal, one in a tournament, whose workers already
+ * fill the cores.
+ */
+template <typename T>
+using PlayerSetup = function<void(Player<T>* player, int search_threads)>;
+
+/**
+ * @brief Build the registry entry of a variant.
+ *
+ * @tparam T Symbol type of the variant
+ * @tparam B Board class; default-constructible
+ * @tparam U UI class; default-constructible
+ * @param name Name given to --game
+ * @param title Menu text
+ * @param intro Line printed before a game on the terminal
+ * @param first, second Symbols of players 1 and 2, as the UI's
+ * setup_players() assigns them
+ * @param setup Attaches the variant's engines (see PlayerSetup)
+ */
+template <typename T, typename B, typename U>
+GameEntry make_game_entry(const string& name, const string& title, const string& intro,
+                          T first, T second, PlayerSetup<T> setup) {
+    GameEntry entry;
+    entry.name = name;
+    entry.title = title;
+
+    entry.play_interactive = [intro, setup](uint64_t seed) {
+        cout << "\n" << intro << endl;
+        UI<T>* ui = new U();
+        Board<T>* board = new B();
+        Player<T>** players = ui->setup_players();
+        const int search_threads = static_cast<int>(thread::hardware_concurrency());
+        setup(players[0], search_threads);
+        setup(players[1], search_threads);
+        GameManager<T> manager(board, players, ui, seed);
+
+        manager.run();
+
+        delete board;
+        delete players[0];
+        delete players[1];
+        delete[] players;
+        delete ui;
+    };
+
+    entry.play = [name, first, second, setup](const GameOptions& options) {
+        const bool on_terminal = options.games == 1 && !options.quiet;
+        const int search_threads = on_terminal ? static_cast<int>(thread::hardware_concurrency()) : 1;
+        auto make_player = [first, second, setup, options, search_threads](UI<T>* ui, int i) {
+            string player_name = i == 0 ? "Player 1" : "Player 2";
+            Player<T>* player = ui->create_player(player_name, i == 0 ? first : second, options.players[i]);
+            setup(player, search_threads);
+            return player;
+        };
+
+        // Check the engines on a throwaway set before playing anything
+        bool ok = true;
+        {
+            SilentOutput silence;
+            UI<T>* ui = new U();
+            for (int i : {0, 1}) {
+                Player<T>* player = make_player(ui, i);
+                if (player->get_type() == PlayerType::HUMAN && !on_terminal) {
+                    cerr << name << ": human players can only play a single game without --quiet\n";
+                    ok = false;
+                }
+                else if (player->get_type() != PlayerType::HUMAN && !player->get_strategy()) {
+                    cerr << name << ": player " << i + 1 << " has no engine of that kind in this game\n";
+                    ok = false;
+                }
+                delete player;
+            }
+            delete ui;
+        }
+        if (!ok) return 1;
+
+        if (on_terminal) {
+            UI<T>* ui = new U();
+            Board<T>* board = new B();
+            Player<T>* players[2] = { make_player(ui, 0), make_player(ui, 1) };
+            GameManager<T> manager(board, players, ui, options.seed);
+
+            manager.run();
+
+            delete players[0];
+            delete players[1];
+            delete board;
+            delete ui;
+            return 0;
+        }
+
+        Tournament<T> tournament([]() { return new U(); }, []() { return new B(); }, make_player);
+        TournamentResult r = tournament.run(options.games, options.threads, 64, options.seed);
+        cout << name << ": " << r.games << " games, Player 1 wins " << r.wins[0]
+             << ", Player 2 wins " << r.wins[1] << ", draws " << r.draws
+             << ", " << r.moves << " moves, " << r.seconds << " s, "
+             << r.games_per_second() << " games/s" << endl;
+        r.stats.print(cerr);
+        return 0;
+    };
+
+    entry.perft = [first](int depth, int threads, uint64_t seed) {
+        unique_ptr<Board<T>> board;
+        {
+            SilentOutput silence; // some boards print while loading
+            board.reset(new B());
+        }
+        board->seed(RandomEngine::derive(seed, 0));
+        board->reset();
+        return parallel_perft<T>(*board, first, depth, threads);
+    };
+    return entry;
+}
+
+/**
+ * @class GameRegistry
+ * @brief The game variants, in menu order.
+ */
+class GameRegistry {
+    vector<GameEntry> entries; ///< Variants in the order they were added
+
+public:
+    /**
+     * @brief Append a variant; it gets the next menu number.
+     * @param perft_counts Its known-good perft counts, from depth 1 up
+     */
+    void add(const GameEntry& entry, const vector<uint64_t>& perft_counts = {}) {
+        entries.push_back(entry);
+        entries.back().perft_counts = perft_counts;
+    }
+
+    /** @brief All variants; the index of each is its menu number. */
+    const vector<GameEntry>& all() const { return entries; }
+
+    /** @brief The variant registered as `name`, or nullptr if there is none. */
+    const GameEntry* find(const string& name) const {
+        for (const GameEntry& entry : entries)
+            if (entry.name == name) return &entry;
+        return nullptr;
+    }
+};
+
+/**
+ * @brief Map an engine name to a player type.
+ *
+ * "human", "computer" (the game's own bot, random moves by default),
+ * "search" (the game's search engine) and "ai" (the game's MCTS engine,
+ * where it has one).
+ *
+ * @return false if `name` is none of these.
+ */
+inline bool parse_player_type(const string& name, PlayerType& type) {
+    if (name == "human") type = PlayerType::HUMAN;
+    else if (name == "computer") type = PlayerType::COMPUTER;
+    else if (name == "search") type = PlayerType::SEARCH;
+    else if (name == "ai") type = PlayerType::AI;
+    else return false;
+    return true;
+}
+
+#endif // GAME_REGISTRY_H
@@ -0,0 +1,200 @@
+/**
+ * @file GameStats.h
+ * @brief Where the time of each turn goes, measured inside GameManager.
+ *
+ * This file provides:
+ * - `GameStats`: Per-section call counts and timings of a game loop,
+ *   plus the number of moves the board rejected.
+ *
+ * GameManager times four sections of every turn:
+ * - `decision`: getting a move from the player's strategy or the UI,
+ *   including a human's thinking time,
+ * - `update`: update_board(), accepted or not,
+ * - `render`: displaying the board and the final message,
+ * - `win_check`: evaluate_outcome().
+ *
+ * The counters are compiled out by default: GameStats is then an empty
+ * class whose calls are all empty inline functions, so the game loop is
+ * the same code as without them. Build with `-DBOARDGAME_STATS` to turn
+ * them on, and GameManager::run() prints a text table to cerr after each
+ * game; `-DBOARDGAME_STATS_JSON` does the same with JSON instead.
+ * run_batch() and Tournament print one report for all their games.
+ */
+
+#ifndef GAME_STATS_H
+#define GAME_STATS_H
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(BOARDGAME_STATS_JSON) && !defined(BOARDGAME_STATS)
+#define BOARDGAME_STATS
+#endif
+
+using namespace std;
+
+#ifdef BOARDGAME_STATS
+
+/**
+ * @class GameStats
+ * @brief Call counts, total and worst-case time of each turn section.
+ *
+ * Not thread-safe: each GameManager has its own, and Tournament merges
+ * the workers' copies after they join.
+ */
+class GameStats {
+public:
+    /** @brief A timed part of a turn. */
+    enum Section { DECISION, UPDATE, RENDER, WIN_CHECK, SECTIONS };
+
+    /**
+     * @brief Adds the time from its construction to its destruction to one
+     * section.
+     */
+    class Timer {
+        GameStats* stats;
+        Section section;
+        chrono::steady_clock::time_point start;
+
+    public:
+        Timer(GameStats* s, Section sec)
+            : stats(s), section(sec), start(chrono::steady_clock::now()) {
+        }
+        Timer(Timer&& other) : stats(other.stats), section(other.section), start(other.start) {
+            other.stats = nullptr;
+        }
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        ~Timer() {
+            if (stats) stats->record(section, chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now() - start).count());
+        }
+    };
+
+    /** @brief Time `section` until the returned Timer goes out of scope. */
+    Timer time(Section section) { return Timer(this, section); }
+
+    /** @brief Count a move the board did not accept. */
+    void count_rejected() { ++rejected; }
+
+    /** @brief Count a finished game. */
+    void count_game() { ++games; }
+
+    /** @brief Zero every counter. */
+    void reset() { *this = GameStats(); }
+
+    /** @brief Add another set of counters to these. */
+    void merge(const GameStats& other) {
+        for (int s = 0; s < SECTIONS; ++s) {
+            totals[s].calls += other.totals[s].calls;
+            totals[s].total_ns += other.totals[s].total_ns;
+            totals[s].max_ns = max(totals[s].max_ns, other.totals[s].max_ns);
+        }
+        rejected += other.rejected;
+        games += other.games;
+    }
+
+    /**
+     * @brief Write the report: a text table, or JSON when built with
+     * BOARDGAME_STATS_JSON.
+     */
+    void print(ostream& out) const {
+#ifdef BOARDGAME_STATS_JSON
+        print_json(out);
+#else
+        print_table(out);
+#endif
+    }
+
+    /** @brief One row per section, times in microseconds. */
+    void print_table(ostream& out) const {
+        ios::fmtflags flags = out.flags();
+        out << "Turn timings: " << games << " games, " << moves() << " moves, "
+            << rejected << " rejected moves\n"
+            << left << setw(10) << "section" << right << setw(10) << "calls"
+            << setw(14) << "total us" << setw(12) << "mean us" << setw(12) << "max us" << "\n"
+            << fixed << setprecision(1);
+        for (int s = 0; s < SECTIONS; ++s) {
+            const Totals& t = totals[s];
+            out << left << setw(10) << name(Section(s)) << right << setw(10) << t.calls
+                << setw(14) << t.total_ns / 1e3 << setw(12) << mean_us(t)
+                << setw(12) << t.max_ns / 1e3 << "\n";
+        }
+        out.flags(flags);
+    }
+
+    /** @brief The same numbers as one JSON object. */
+    void print_json(ostream& out) const {
+        out << "{\"games\": " << games << ", \"moves\": " << moves()
+            << ", \"rejected\": " << rejected << ", \"sections\": {";
+        for (int s = 0; s < SECTIONS; ++s) {
+            const Totals& t = totals[s];
+            out << (s ? ", " : "") << "\"" << name(Section(s)) << "\": {\"calls\": " << t.calls
+                << ", \"total_us\": " << t.total_ns / 1e3 << ", \"mean_us\": " << mean_us(t)
+                << ", \"max_us\": " << t.max_ns / 1e3 << "}";
+        }
+        out << "}}\n";
+    }
+
+private:
+    /** @brief Counters of one section. */
+    struct Totals {
+        long calls = 0;
+        int64_t total_ns = 0;
+        int64_t max_ns = 0;
+    };
+
+    Totals totals[SECTIONS]; ///< Indexed by Section
+    long rejected = 0;       ///< Moves update_board() turned down
+    long games = 0;          ///< Games finished
+
+    void record(Section section, int64_t ns) {
+        Totals& t = totals[section];
+        t.calls++;
+        t.total_ns += ns;
+        if (ns > t.max_ns) t.max_ns = ns;
+    }
+
+    /** @brief Accepted moves: every update_board() call that was not rejected. */
+    long moves() const { return totals[UPDATE].calls - rejected; }
+
+    static double mean_us(const Totals& t) { return t.calls ? t.total_ns / 1e3 / t.calls : 0.0; }
+
+    static const char* name(Section section) {
+        static const char* const names[SECTIONS] = { "decision", "update", "render", "win_check" };
+        return names[section];
+    }
+};
+
+#else
+
+/**
+ * @class GameStats
+ * @brief Stand-in with the same interface that does nothing; build with
+ * BOARDGAME_STATS for the real counters.
+ */
+class GameStats {
+public:
+    enum Section { DECISION, UPDATE, RENDER, WIN_CHECK, SECTIONS };
+
+    class Timer {
+    public:
+        ~Timer() {}
+    };
+
+    Timer time(Section) { return Timer(); }
+    void count_rejected() {}
+    void count_game() {}
+    void reset() {}
+    void merge(const GameStats&) {}
+    void print(ostream&) const {}
+    void print_table(ostream&) const {}
+    void print_json(ostream&) const {}
+};
+
+#endif // BOARDGAME_STATS
+
+#endif // GAME_STATS_H
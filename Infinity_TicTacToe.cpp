@@ -1,13 +1,36 @@
 #include "Infinity_TicTacToe.h"
+#include "WinLines.h"
 #include <iostream>
 #include <cctype>
 
 using namespace std;
 
-Infinity_Board::Infinity_Board() : Board<char>(3, 3) {
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+// Rows, columns and diagonals of the 3x3 board, as masks over marks_of()
+static constexpr WinLines<3, 3, 3> infinity_lines;
+
+Infinity_Board::Infinity_Board() : XOBoardBase(3, 3) {
+    zobrist = ZobristKeys(rows, columns, 6);
+    reset();
+}
+
+void Infinity_Board::reset() {
+    board.fill(blank_symbol);
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    player_x_moves.clear();
+    player_o_moves.clear();
+    history.clear();
+    x_move_count = 0;
+    o_move_count = 0;
+}
+
+void Infinity_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool Infinity_Board::update_board(Move<char>* move) {
@@ -24,64 +47,90 @@ bool Infinity_Board::update_board(Move<char>* move) {
     }
 
     board[x][y] = mark;
+    toggle_mark(x, y, mark);
     n_moves++;
+    UndoEntry entry = { x, y, -1, -1 };
 
     if (mark == 'X') {
-        player_x_moves.push({ x, y });
+        hash ^= queue_key(player_x_moves, 0);
+        player_x_moves.push_back({ x, y });
         x_move_count++;
 
         if (x_move_count > 3) {
             auto oldest = player_x_moves.front();
-            player_x_moves.pop();
+            player_x_moves.pop_front();
             board[oldest.first][oldest.second] = blank_symbol;
+            toggle_mark(oldest.first, oldest.second, mark);
             n_moves--;
+            entry.evicted_x = oldest.first;
+            entry.evicted_y = oldest.second;
         }
+        hash ^= queue_key(player_x_moves, 0) ^ zobrist.side();
     }
     else if (mark == 'O') {
-        player_o_moves.push({ x, y }); 
+        hash ^= queue_key(player_o_moves, 1);
+        player_o_moves.push_back({ x, y }); 
         o_move_count++;
 
         if (o_move_count > 3) {
             auto oldest = player_o_moves.front();
-            player_o_moves.pop();
+            player_o_moves.pop_front();
             board[oldest.first][oldest.second] = blank_symbol;
+            toggle_mark(oldest.first, oldest.second, mark);
             n_moves--;
+            entry.evicted_x = oldest.first;
+            entry.evicted_y = oldest.second;
         }
+        hash ^= queue_key(player_o_moves, 1) ^ zobrist.side();
     }
+    history.push_back(entry);
 
     return true;
 }
 
-bool Infinity_Board::is_win(Player<char>* player) {
-    const char sym = toupper(player->get_symbol());
-
-    auto all_equal = [&](char a, char b, char c) {
-        return a == b && b == c && a == sym;
-        };
-
-    for (int i = 0; i < rows; ++i) {
-        if (all_equal(board[i][0], board[i][1], board[i][2]))
-            return true;
+bool Infinity_Board::undo_move() {
+    if (history.empty()) return false;
+
+    UndoEntry entry = history.back();
+    history.pop_back();
+
+    char mark = board[entry.x][entry.y];
+    deque<pair<int, int>>& moves = (mark == 'X') ? player_x_moves : player_o_moves;
+    int& move_count = (mark == 'X') ? x_move_count : o_move_count;
+    int player = (mark == 'X') ? 0 : 1;
+
+    hash ^= queue_key(moves, player);
+    moves.pop_back();
+    move_count--;
+    board[entry.x][entry.y] = blank_symbol;
+    toggle_mark(entry.x, entry.y, mark);
+    n_moves--;
+
+    if (entry.evicted_x != -1) {
+        moves.push_front({ entry.evicted_x, entry.evicted_y });
+        board[entry.evicted_x][entry.evicted_y] = mark;
+        toggle_mark(entry.evicted_x, entry.evicted_y, mark);
+        n_moves++;
     }
+    hash ^= queue_key(moves, player) ^ zobrist.side();
+    return true;
+}
 
-    for (int i = 0; i < columns; ++i) {
-        if (all_equal(board[0][i], board[1][i], board[2][i]))
-            return true;
-    }
-
-    if (all_equal(board[0][0], board[1][1], board[2][2]))
-        return true;
-
-    if (all_equal(board[0][2], board[1][1], board[2][0]))
-        return true;
-
-    return false;
+bool Infinity_Board::is_win(Player<char>* player) {
+    return infinity_lines.any(marks_of(toupper(player->get_symbol())));
 }
 
 bool Infinity_Board::game_is_over(Player<char>* player) {
     return is_win(player);
 }
 
+Outcome Infinity_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (infinity_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return Outcome::ONGOING;
+}
+
 Infinity_UI::Infinity_UI()
     : UI<char>("Welcome to FCAI Infinity Tic-Tac-Toe Game!", 3) {
     cout << "\n=== Game Rules ===" << endl;
@@ -97,30 +146,19 @@ Player<char>* Infinity_UI::create_player(string& name, char symbol, PlayerType t
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Infinity_UI::get_move(Player<char>* player) {
+Move<char> Infinity_UI::get_move(Player<char>* player) {
     int x, y;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\n" << player->get_name() << " (" << player->get_symbol()
-            << "), enter your move (row and column, 0-2): ";
-        cin >> x >> y;
+    cout << "\n" << player->get_name() << " (" << player->get_symbol()
+        << "), enter your move (row and column, 0-2): ";
+    cin >> x >> y;
 
-        while (cin.fail()) {
-            cin.clear();
-            cin.ignore(1000, '\n');
-            cout << "Invalid input. Enter row and column (0-2): ";
-            cin >> x >> y;
-        }
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        do {
-            x = rand() % player->get_board_ptr()->get_rows();
-            y = rand() % player->get_board_ptr()->get_columns();
-        } while (player->get_board_ptr()->get_board_matrix()[x][y] != '.');
-
-        cout << "\nComputer " << player->get_name() << " plays at position ("
-            << x << ", " << y << ")" << endl;
+    while (cin.fail()) {
+        cin.clear();
+        cin.ignore(1000, '\n');
+        cout << "Invalid input. Enter row and column (0-2): ";
+        cin >> x >> y;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
\ No newline at end of file
@@ -15,7 +15,8 @@
 #define INFINITY_TICTACTOE_H
 
 #include "BoardGame_Classes.h"
-#include <queue>
+#include "XOBoardBase.h"
+#include <deque>
 
 using namespace std;
 
@@ -37,29 +38,54 @@ using namespace std;
  *
  * @see Board
  */
-class Infinity_Board : public Board<char> {
+class Infinity_Board final : public XOBoardBase {
 private:
     char blank_symbol = '.'; ///< Character representing empty cells
 
     /**
-     * @brief Queue storing X player's move positions in chronological order.
+     * @brief X player's move positions in chronological order.
      *
      * Stores pairs of (row, col) coordinates. Used to track and remove
-     * the oldest move when player exceeds 3 pieces.
+     * the oldest move when player exceeds 3 pieces; undo_move() puts an
+     * evicted move back at the front.
      */
-    queue<pair<int, int>> player_x_moves;
+    deque<pair<int, int>> player_x_moves;
 
     /**
-     * @brief Queue storing O player's move positions in chronological order.
+     * @brief O player's move positions in chronological order.
      *
      * Stores pairs of (row, col) coordinates. Used to track and remove
-     * the oldest move when player exceeds 3 pieces.
+     * the oldest move when player exceeds 3 pieces; undo_move() puts an
+     * evicted move back at the front.
      */
-    queue<pair<int, int>> player_o_moves;
+    deque<pair<int, int>> player_o_moves;
 
     int x_move_count = 0; ///< Total number of moves made by X player
     int o_move_count = 0; ///< Total number of moves made by O player
 
+    /** @brief What an applied move changed, for undo_move(). */
+    struct UndoEntry {
+        int x, y;                 ///< Cell the mark was placed in
+        int evicted_x, evicted_y; ///< Oldest mark removed by the move (-1 if none)
+    };
+    vector<UndoEntry> history; ///< Applied moves, oldest first
+
+    /**
+     * @brief Hash keys of one player's marks, keyed by cell and age.
+     *
+     * Which mark vanishes next is part of the position, so a mark's key
+     * depends on its place in the queue, not just on the cell it is in.
+     *
+     * @param moves The player's move queue, oldest first
+     * @param player 0 for X, 1 for O
+     */
+    uint64_t queue_key(const deque<pair<int, int>>& moves, int player) const {
+        uint64_t key = 0;
+        for (size_t i = 0; i < moves.size(); ++i)
+            key ^= zobrist.cell(moves[i].first, moves[i].second, player * 3 + (int)i);
+        return key;
+    }
+
 public:
     /**
      * @brief Constructs a 33 Infinity board.
@@ -124,6 +150,43 @@ public:
      * @return true if player has won, false otherwise
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Checks only the lines through the cell just filled.
+     *
+     * Removing the mover's oldest mark cannot complete a line, and the
+     * opponent's marks did not change, so no other line needs checking.
+     *
+     * @param last_move The move just applied
+     * @return WIN for three in a row, otherwise ONGOING (no draws or losses)
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board for a new game.
+     *
+     * Clears all cells, empties both move queues and resets the move counters.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new Infinity_Board(*this); }
+
+    /**
+     * @brief Lists every empty cell. A player's oldest mark only
+     * vanishes after the move is applied, so it is never listed.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     *
+     * Removes the mark and puts back the oldest mark it evicted, if any.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 };
 
 /**
@@ -164,20 +227,15 @@ public:
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a move from a player.
+     * @brief Gets a move from a human player.
      *
-     * For human players:
      * - Prompts for row and column (0-2)
      * - Validates input
      *
-     * For computer players:
-     * - Randomly selects empty cell
-     * - Displays chosen position
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move object with position and symbol
+     * @return Move object with position and symbol
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif // INFINITY_TICTACTOE_H
\ No newline at end of file
@@ -0,0 +1,431 @@
+/**
+ * @file MCTSEngine.h
+ * @brief Monte Carlo Tree Search (UCT) usable as any player's strategy.
+ *
+ * This file provides:
+ * - `NodePool`: A fixed block of tree nodes handed out contiguously and
+ *   released all at once, safe to allocate from on several threads.
+ * - `MCTSMode`: How a multi-threaded search shares its work.
+ * - `MCTSEngine`: UCT search that needs no evaluation function, only random
+ *   playouts to the end of the game, on one thread or several.
+ *
+ * It suits games where a hand-written evaluation is weak (5x5, Ultimate,
+ * Obstacles, Word). Like NegamaxEngine it works on the live board through
+ * update_board() and undo_move(), and plays out games with the board's
+ * random_move(). Extra search threads each work on their own
+ * Board::clone() of it. Like NegamaxEngine it searches with random events
+ * switched off (see ChanceFreeSearch).
+ */
+
+#ifndef MCTS_ENGINE_H
+#define MCTS_ENGINE_H
+
+#include "BoardGame_Classes.h"
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+using namespace std;
+
+/**
+ * @class NodePool
+ * @brief Contiguous storage for search tree nodes.
+ *
+ * @tparam Node Node type; must be default constructible.
+ *
+ * All nodes live in one block allocated up front. allocate() hands out the
+ * next n nodes in a row, so a node's children sit next to each other, and
+ * reset() releases every node at once without touching the heap. Threads
+ * may allocate at the same time; reset() must not race with them.
+ */
+template <typename Node>
+class NodePool {
+    vector<Node> nodes; ///< The block
+    atomic<int> used;   ///< Nodes handed out since the last reset(); may overshoot the block
+
+public:
+    /** @brief Create a pool of `capacity` nodes. */
+    explicit NodePool(int capacity) : nodes(capacity), used(0) {}
+
+    /**
+     * @brief Hand out n contiguous nodes.
+     * @return Index of the first node, or -1 if fewer than n are left.
+     */
+    int allocate(int n) {
+        const int capacity = static_cast<int>(nodes.size());
+        if (used.load(memory_order_relaxed) + n > capacity) return -1;
+        int first = used.fetch_add(n, memory_order_relaxed);
+        return first + n > capacity ? -1 : first;
+    }
+
+    /** @brief Release every node. */
+    void reset() { used.store(0, memory_order_relaxed); }
+
+    /** @brief Number of nodes handed out. */
+    int size() const { return min(used.load(memory_order_relaxed), static_cast<int>(nodes.size())); }
+
+    /** @brief Node at index i. */
+    Node& operator[](int i) { return nodes[i]; }
+};
+
+/**
+ * @brief How MCTSEngine spreads one search over several threads.
+ */
+enum class MCTSMode : uint8_t {
+    TREE, ///< All threads grow one shared tree
+    ROOT  ///< Each thread grows its own tree; root visit counts are summed at the end
+};
+
+/**
+ * @class MCTSEngine
+ * @brief UCT search over any Board<T>.
+ *
+ * @tparam T Type of symbol placed on the board.
+ * @tparam B Board class searched (see NegamaxEngine).
+ *
+ * Each iteration walks down the tree picking children by UCB1, expands the
+ * leaf with all of its moves, plays one random game from there and adds
+ * the result (1 for a win, 1/2 for a draw) to every node on the path, from
+ * the point of view of the player who moved into the node. The move
+ * played is the root child visited most.
+ *
+ * With more than one thread the iterations are shared out between them.
+ * In TREE mode they all work on one tree whose counters are atomic. A
+ * visit is counted on the way down and its result added on the way back
+ * up, so until a playout finishes its path looks like a loss to the other
+ * threads (a "virtual loss") and they spread out over other moves instead
+ * of piling onto the same line. A leaf is expanded by whichever thread
+ * claims it first; the others play out from it meanwhile. In ROOT mode
+ * every thread grows a private tree with its share of the node pool and
+ * the iterations, and the trees only meet when their root visit counts
+ * are added up, which scales without contention but searches less deeply.
+ *
+ * The iteration count can be combined with a per-move budget (see
+ * MoveStrategy::set_limits) of time or playouts, and with a CancelToken;
+ * the search stops at whichever runs out first and plays the most visited
+ * move so far.
+ *
+ * The trees are rebuilt for every move. Their nodes come from NodePools
+ * that are reset between moves; when a pool runs out, leaves stop
+ * expanding and iterations just play out from them. The one exception is
+ * a search of the same position as the last one, as after pondering (see
+ * MoveStrategy::ponder) on the reply the engine expected, the most visited
+ * answer to its move: the trees are kept, and their iterations count
+ * towards the new search's.
+ */
+template <typename T, typename B = Board<T>>
+class MCTSEngine : public MoveStrategy<T> {
+    /** @brief One position in the tree, reached by `move`. */
+    struct Node {
+        Move<T> move;              ///< Move from the parent to this node
+        int parent;                ///< Index of the parent node (-1 for the root)
+        int first_child;           ///< Index of the first child, once EXPANDED
+        int child_count;           ///< Number of children, once EXPANDED
+        atomic<int> visits;        ///< Iterations through this node, including unfinished ones
+        atomic<int> score;         ///< Sum of results for the player who made `move`
+        atomic<signed char> state; ///< Expansion state (UNEXPANDED, EXPANDING, EXPANDED, NO_ROOM)
+        atomic<signed char> result; ///< Game result if `move` ended it, NOT_OVER, or UNKNOWN until first reached
+    };
+
+    // Node::result values, relative to the player who made the node's move;
+    // a node's score adds up these, so a win counts 2 and a draw 1
+    static const signed char UNKNOWN = -2;
+    static const signed char NOT_OVER = -1;
+    static const signed char LOST = 0;
+    static const signed char DRAWN = 1;
+    static const signed char WON = 2;
+
+    // Node::state values. first_child and child_count are published by
+    // the release store of EXPANDED.
+    static const signed char UNEXPANDED = 0;
+    static const signed char EXPANDING = 1;
+    static const signed char EXPANDED = 2;
+    static const signed char NO_ROOM = 3; ///< The pool was full; stays a leaf
+
+    long iterations;     ///< Iterations per move, over all threads
+    int max_playout;     ///< Playout length after which the game counts as a draw
+    double exploration;  ///< UCB1 exploration constant
+    int threads;         ///< Search threads, the calling thread included
+    MCTSMode mode;       ///< How the threads share the search
+    vector<unique_ptr<NodePool<Node>>> pools; ///< One tree in TREE mode, one per thread in ROOT mode
+    RandomEngine rng;    ///< Seeds each search's playout engines
+
+    bool tree_kept = false;  ///< The trees hold a finished search of tree_hash
+    uint64_t tree_hash = 0;  ///< Hash of the position the trees were grown for
+    T tree_symbol = T();     ///< Player the trees were grown for
+    bool has_reply = false;  ///< expected_reply is set
+    Move<T> expected_reply;  ///< Most visited answer to the last move chosen
+
+    /** @brief Clear a freshly allocated node. */
+    static void init_node(Node& n, const Move<T>& move, int parent) {
+        n.move = move;
+        n.parent = parent;
+        n.first_child = -1;
+        n.child_count = 0;
+        n.visits.store(0, memory_order_relaxed);
+        n.score.store(0, memory_order_relaxed);
+        n.state.store(UNEXPANDED, memory_order_relaxed);
+        n.result.store(UNKNOWN, memory_order_relaxed);
+    }
+
+    /** @brief Child of `node` with the best UCB1 value; unvisited children first. */
+    int select_child(NodePool<Node>& pool, int node) const {
+        Node& n = pool[node];
+        const float log_visits = static_cast<float>(log(static_cast<double>(n.visits.load(memory_order_relaxed))));
+        int best = n.first_child;
+        float best_value = -1.0f;
+        for (int c = n.first_child; c < n.first_child + n.child_count; ++c) {
+            const Node& child = pool[c];
+            const int visits = child.visits.load(memory_order_relaxed);
+            if (visits == 0) return c;
+            float value = child.score.load(memory_order_relaxed) / (2.0f * visits)
+                + static_cast<float>(exploration) * sqrt(log_visits / visits);
+            if (value > best_value) {
+                best_value = value;
+                best = c;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Give `node` one child per legal move of `side`.
+     * @return false if another thread is expanding it or the pool is full.
+     */
+    bool expand(B& board, NodePool<Node>& pool, int node, T side) {
+        Node& n = pool[node];
+        signed char expected = UNEXPANDED;
+        if (!n.state.compare_exchange_strong(expected, EXPANDING, memory_order_relaxed))
+            return false;
+
+        MoveList<T> moves;
+        board.generate_moves(side, moves);
+        int first = pool.allocate(moves.size());
+        if (first < 0) {
+            n.state.store(NO_ROOM, memory_order_relaxed);
+            return false;
+        }
+        for (int i = 0; i < moves.size(); ++i)
+            init_node(pool[first + i], moves[i], node);
+        n.first_child = first;
+        n.child_count = moves.size();
+        n.state.store(EXPANDED, memory_order_release);
+        return true;
+    }
+
+    /** @brief Node::result value of an outcome. */
+    static signed char result_of(Outcome outcome) {
+        switch (outcome) {
+        case Outcome::WIN: return WON;
+        case Outcome::LOSS: return LOST;
+        case Outcome::DRAW: return DRAWN;
+        default: return NOT_OVER;
+        }
+    }
+
+    /**
+     * @brief Play random moves from the board's position until the game ends.
+     * @param side Symbol of the player to move.
+     * @param made Incremented per move played, so the caller can undo them.
+     * @return Result for the player who made the move before `side`'s.
+     */
+    signed char playout(B& board, T side, RandomEngine& random, int& made) {
+        bool last_mover = false; // false: the player before `side`
+        for (int ply = 0; ply < max_playout; ++ply) {
+            Move<T> m;
+            if (!board.random_move(side, random, m) || !board.update_board(&m)) return DRAWN;
+            ++made;
+            last_mover = !last_mover;
+            signed char result = result_of(board.evaluate_outcome(m));
+            if (result != NOT_OVER)
+                return last_mover ? static_cast<signed char>(WON - result) : result;
+            side = board.other_symbol(side);
+        }
+        return DRAWN;
+    }
+
+    /**
+     * @brief Run iterations on the tree rooted at node 0 of `pool` until
+     * `budget` is used up or `deadline` has passed.
+     *
+     * `budget` may be shared with other threads working on the same tree,
+     * each with its own board in the root position; a thread that sees the
+     * deadline pass empties it for all of them.
+     */
+    void search(B& board, NodePool<Node>& pool, T symbol, RandomEngine& random, atomic<long>& budget,
+        const SearchDeadline& deadline) {
+        for (long done = 1; budget.fetch_sub(1, memory_order_relaxed) > 0; ++done) {
+            if (done % 64 == 0 && deadline.passed()) {
+                budget.store(0, memory_order_relaxed);
+                break;
+            }
+
+            // Selection: descend while the node is expanded and the game goes
+            // on, counting the visit (the virtual loss) on the way down. A
+            // leaf is expanded on its second visit.
+            int node = 0;
+            T side = symbol;
+            int made = 0;
+            signed char result = NOT_OVER;
+            pool[node].visits.fetch_add(1, memory_order_relaxed);
+            for (;;) {
+                Node& n = pool[node];
+                if (n.state.load(memory_order_acquire) != EXPANDED
+                    && (n.visits.load(memory_order_relaxed) < 2 || !expand(board, pool, node, side)))
+                    break;
+                if (n.child_count == 0) break;
+
+                node = select_child(pool, node);
+                Node& child = pool[node];
+                child.visits.fetch_add(1, memory_order_relaxed);
+                Move<T> m = child.move;
+                board.update_board(&m);
+                ++made;
+                result = child.result.load(memory_order_relaxed);
+                if (result == UNKNOWN) {
+                    result = result_of(board.evaluate_outcome(m));
+                    child.result.store(result, memory_order_relaxed);
+                }
+                side = board.other_symbol(side);
+                if (result != NOT_OVER) break;
+            }
+
+            // Simulation; `result` is for the player who moved into `node`
+            if (result == NOT_OVER)
+                result = playout(board, side, random, made);
+            while (made-- > 0) board.undo_move();
+
+            // Backpropagation, flipping the point of view at every level
+            int reward = result;
+            for (; node >= 0; node = pool[node].parent) {
+                pool[node].score.fetch_add(reward, memory_order_relaxed);
+                reward = WON - reward;
+            }
+        }
+    }
+
+protected:
+    /** @brief The most visited answer to the last move chosen. */
+    bool predict_reply(Move<T>& reply) const override {
+        if (!has_reply) return false;
+        reply = expected_reply;
+        return true;
+    }
+
+public:
+    /**
+     * @brief Create an engine.
+     * @param iterations Playouts per move, over all threads.
+     * @param max_nodes Capacity of the node pool, over all threads.
+     * @param exploration UCB1 exploration constant.
+     * @param max_playout Moves after which a playout counts as a draw, for
+     * games that can go on forever.
+     * @param threads Search threads, the calling thread included (at least 1).
+     * @param mode How several threads share the search.
+     */
+    explicit MCTSEngine(long iterations = 100000, int max_nodes = 1 << 19,
+        double exploration = 1.4, int max_playout = 200,
+        int threads = 1, MCTSMode mode = MCTSMode::TREE)
+        : iterations(iterations), max_playout(max_playout), exploration(exploration),
+          threads(max(1, threads)), mode(mode) {
+        const int trees = (mode == MCTSMode::ROOT) ? this->threads : 1;
+        for (int t = 0; t < trees; ++t)
+            pools.emplace_back(new NodePool<Node>(max(1, max_nodes / trees)));
+    }
+
+    /** @brief Destroy the engine, stopping any pondering first. */
+    ~MCTSEngine() { this->stop_pondering(); }
+
+    /**
+     * @brief Reseed the playout engines. Also drops the kept trees, so a
+     * new game never starts from the last one's.
+     */
+    void seed(uint64_t s) override {
+        rng.seed(s);
+        tree_kept = has_reply = false;
+    }
+
+    /**
+     * @brief Search the board's position and return the most visited move
+     * for `symbol` once the iterations or the budget run out, leaving the
+     * board as it was.
+     */
+    Move<T> choose_move(Board<T>& board, T symbol) override {
+        B& b = static_cast<B&>(board);
+        ChanceFreeSearch<T> chance_free(b);
+        const SearchDeadline deadline(this->limits, this->cancel_token);
+        const long playouts = this->limits.nodes > 0 ? min(iterations, this->limits.nodes) : iterations;
+        const int trees = static_cast<int>(pools.size());
+        const bool reuse = tree_kept && b.get_hash() == tree_hash && symbol == tree_symbol;
+        tree_kept = has_reply = false;
+        unique_ptr<atomic<long>[]> budgets(new atomic<long>[trees]);
+        for (int t = 0; t < trees; ++t) {
+            NodePool<Node>& pool = *pools[t];
+            if (!reuse) {
+                pool.reset();
+                init_node(pool[pool.allocate(1)], Move<T>(), -1);
+                pool[0].result.store(NOT_OVER, memory_order_relaxed);
+                if (!expand(b, pool, 0, symbol) || pool[0].child_count == 0) return Move<T>();
+            }
+            const long share = playouts / trees + (t < playouts % trees ? 1 : 0);
+            budgets[t].store(max(0L, share - pool[0].visits.load(memory_order_relaxed)), memory_order_relaxed);
+        }
+
+        // The calling thread searches the live board, the others a copy each
+        const uint64_t search_seed = rng.next();
+        vector<unique_ptr<Board<T>>> copies;
+        vector<thread> workers;
+        for (int t = 1; t < threads; ++t) {
+            copies.emplace_back(b.clone());
+            B& copy = static_cast<B&>(*copies.back());
+            NodePool<Node>& pool = *pools[t % trees];
+            atomic<long>& budget = budgets[t % trees];
+            workers.emplace_back([this, &copy, &pool, &budget, &deadline, symbol, search_seed, t]() {
+                RandomEngine random(RandomEngine::derive(search_seed, t));
+                search(copy, pool, symbol, random, budget, deadline);
+            });
+        }
+        RandomEngine random(RandomEngine::derive(search_seed, 0));
+        search(b, *pools[0], symbol, random, budgets[0], deadline);
+        for (thread& worker : workers) worker.join();
+
+        // Every tree lists the root's moves in generate_moves() order
+        NodePool<Node>& first_pool = *pools[0];
+        const int first_child = first_pool[0].first_child;
+        const int child_count = first_pool[0].child_count;
+        int best = 0;
+        long best_visits = -1;
+        for (int i = 0; i < child_count; ++i) {
+            long visits = 0;
+            for (auto& pool : pools)
+                visits += (*pool)[(*pool)[0].first_child + i].visits.load(memory_order_relaxed);
+            if (visits > best_visits) {
+                best_visits = visits;
+                best = i;
+            }
+        }
+
+        tree_kept = true;
+        tree_hash = b.get_hash();
+        tree_symbol = symbol;
+        const Node& chosen = first_pool[first_child + best];
+        if (chosen.state.load(memory_order_relaxed) == EXPANDED && chosen.child_count > 0) {
+            int reply = chosen.first_child;
+            for (int c = reply; c < chosen.first_child + chosen.child_count; ++c)
+                if (first_pool[c].visits.load(memory_order_relaxed) > first_pool[reply].visits.load(memory_order_relaxed))
+                    reply = c;
+            expected_reply = first_pool[reply].move;
+            has_reply = true;
+        }
+        return chosen.move;
+    }
+
+    /** @brief Tree nodes used by the last search, over all threads. */
+    int get_nodes() const {
+        int total = 0;
+        for (const auto& pool : pools) total += pool->size();
+        return total;
+    }
+};
+
+#endif // MCTS_ENGINE_H
@@ -49,16 +49,18 @@
   * The project uses a template-based inheritance hierarchy:
   *
   * @code
-  * Board<T>                    Player<T>               UI<T>
+  * Board<T>                MoveStrategy<T>            UI<T>
   *    ↑                           ↑                      ↑
   *    |                           |                      |
   * Specific                   Specific               Specific
-  * Game Boards                AI Players             Game UIs
+  * Game Boards                Game Bots              Game UIs
   * @endcode
   *
   * Key components:
   * - **Board<T>**: Abstract base for game boards
+  * - **XOBoardBase**: Board<char> with per-player mark bitboards, for the X/O boards
   * - **Player<T>**: Represents human and computer players
+  * - **MoveStrategy<T>**: Picks a computer player's moves, with no I/O
   * - **Move<T>**: Encapsulates a single move
   * - **UI<T>**: Handles input/output for games
   * - **GameManager<T>**: Orchestrates game flow
@@ -69,9 +71,12 @@
   *
   * 1. Create a board class inheriting from Board<T>
   * 2. Implement required virtual methods (update_board, is_win, etc.)
-  * 3. Create a UI class inheriting from UI<T>
-  * 4. Optionally create custom AI player class
-  * 5. Add to main menu
+  * 3. Create a UI class inheriting from UI<T>; its get_move() serves
+  *    human players only
+  * 4. Optionally give computer players a MoveStrategy<T> of the game's
+  *    own in create_player() (they play random moves otherwise)
+  * 5. Register it in game_registry() (Main_Menu.cpp), which gives it a
+  *    menu entry and a --game name
   *
   * Example:
   * @code
@@ -82,18 +87,30 @@
   * };
   *
   * class MyUI : public UI<char> {
-  *     Move<char>* get_move(Player<char>* player) override { ... }
+  *     Move<char> get_move(Player<char>* player) override { ... }
   *     Player<char>* create_player(...) override { ... }
   * };
   * @endcode
   *
   * @section compile_sec Compilation
   *
-  * Requires C++11 or later:
+  * Requires C++14 or later (WinLines.h builds its tables with constexpr loops):
   * @code
-  * g++ -std=c++11 Main_Menu.cpp [other files] -o game
+  * g++ -std=c++14 Main_Menu.cpp [other files] -o game
   * ./game
   * @endcode
+  * Add -DBOARDGAME_STATS to print where the time of each turn went after
+  * every game (see GameStats.h), or -DBOARDGAME_STATS_JSON for JSON.
+  *
+  * @section cli_sec Command Line
+  *
+  * Run without arguments for the menu. With --game NAME the variant plays
+  * without any prompts, which suits scripts, load tests and benchmarks:
+  * @code
+  * ./game --game xo --p1 search --p2 computer --games 100000 --threads 8 --seed 1 --quiet
+  * @endcode
+  * --p1/--p2 take human, computer, search or ai. More than one game (or
+  * --quiet) runs as a Tournament and prints a single summary line.
   *
   * @section deps_sec Dependencies
   *
@@ -117,6 +134,7 @@
 #include <memory>
 #include <ctime>
 #include <cstdlib>
+#include <thread>
 
 #include "BoardGame_Classes.h"
 #include "XO_Classes.h"
@@ -133,77 +151,294 @@
 #include "MemoryTTT_Classes.h"
 #include "Tic_Tac_Toe_4x4.h"
 #include "Pyramid_Tic_Tac_Toe.h"
+#include "NegamaxEngine.h"
+#include "MCTSEngine.h"
+#include "NineCellTable.h"
+#include "GameRegistry.h"
 
 
 
 using namespace std;
 
 /**
- * @brief Main function providing game selection menu.
+ * @brief PlayerSetup giving every "Search AI" player a NegamaxEngine.
  *
- * Displays a menu of available games, handles user selection,
- * initializes the chosen game with appropriate board and UI classes,
- * runs the game to completion, and performs cleanup.
+ * @param depth Plies the engine searches per move; chosen per game so a
+ * move takes well under a second
+ * @param parallel Lazy SMP search on every thread the game allows (see
+ * PlayerSetup); only worth it for games without hidden information,
+ * where deeper searches pay off
+ */
+template <typename T>
+PlayerSetup<T> search_engine(int depth, bool parallel = false) {
+    return [depth, parallel](Player<T>* player, int search_threads) {
+        if (player->get_type() != PlayerType::SEARCH) return;
+        NegamaxEngine<T>* engine = new NegamaxEngine<T>(depth, 16, parallel ? search_threads : 1);
+        // The depths keep moves well under a second; the time limit only
+        // bounds the rare position that takes much longer
+        engine->set_limits(SearchLimits(2.0));
+        player->set_strategy(engine);
+    };
+}
+
+/**
+ * @brief `setup`, plus an MCTSEngine for every "MCTS AI" player.
  *
- * Menu options (0-12):
- * - 0: Exit program
- * - 1: Four-in-a-Row (Connect Four)
- * - 2: SUS Game
- * - 3: 5×5 Tic-Tac-Toe
- * - 4: Word Tic-Tac-Toe
- * - 5: Misère Tic-Tac-Toe
- * - 6: Diamond Tic-Tac-Toe
- * - 7: 4x4 Tic-Tac-Toe
- * - 8: Prymaid Tic-Tac-Toe
- * - 9: Numerical Tic-Tac-Toe
- * - 10: Obstacles Tic-Tac-Toe
- * - 11: Infinity Tic-Tac-Toe
- * - 12: Ultimate Tic-Tac-Toe
+ * The search is tree-parallel on the threads the game allows (see
+ * PlayerSetup): all cores for a game on the terminal, one per player in
+ * a tournament. Like the Search AI, a move takes at most 2 s.
  *
- * Game lifecycle for each selection:
- * 1. Create UI object
- * 2. Create Board object
- * 3. Setup players via UI
- * 4. Create GameManager
- * 5. Run game
- * 6. Delete all dynamically allocated objects
+ * @tparam B Board class the engine plays out on
+ * @param setup Attaches the game's other engines
+ */
+template <typename T, typename B>
+PlayerSetup<T> mcts_engine(PlayerSetup<T> setup) {
+    return [setup](Player<T>* player, int search_threads) {
+        setup(player, search_threads);
+        if (player->get_type() != PlayerType::AI) return;
+        MCTSEngine<T, B>* engine = new MCTSEngine<T, B>(50000, 1 << 19, 1.4, 200,
+            search_threads, MCTSMode::TREE);
+        engine->set_limits(SearchLimits(2.0));
+        player->set_strategy(engine);
+    };
+}
+
+/**
+ * @brief PlayerSetup giving every "Search AI" player a PerfectPlayStrategy.
  *
- * Memory management:
- * - All dynamically allocated objects are properly deleted
- * - Player array and individual players cleaned up after each game
- * - Board and UI objects deleted before exit
+ * For the nine-cell games, whose boards solve every position once (see
+ * NineCellTable.h), so each move is a lookup instead of a search.
+ */
+template <typename T>
+PlayerSetup<T> perfect_play() {
+    return [](Player<T>* player, int) {
+        if (player->get_type() == PlayerType::SEARCH)
+            player->set_strategy(new PerfectPlayStrategy<T>());
+    };
+}
+
+/**
+ * @brief Every game variant, in menu order.
  *
- * @return 0 on successful execution
+ * To add a variant, register it here; the menu and the command line
+ * pick it up from the registry. The lists after the entries are their
+ * perft counts (see Perft.h), checked against brute-force enumerations
+ * or the plain products of free cells where no game can end yet.
+ * Obstacles has none: its tree depends on where the obstacles fall.
+ */
+GameRegistry game_registry() {
+    GameRegistry games;
+    games.add(make_game_entry<char, X_O_Board, XO_UI>(
+        "xo", "Play X-O Game (Demo)", "Lets play X-O Together...",
+        'X', 'O', perfect_play<char>()),
+        { 9, 72, 504, 3024, 15120, 54720, 148176, 200448, 127872 });
+    games.add(make_game_entry<char, FourInARow_Board, FourInARow_UI>(
+        "four-in-a-row", "Play Four-in-a-Row (Connect Four)", "Starting Four-in-a-Row (Connect Four)...",
+        'X', 'O', search_engine<char>(10, true)),
+        { 7, 49, 343, 2401, 16807, 117649, 823536, 5673234, 39394572 });
+    games.add(make_game_entry<char, SUS_Board, SUS_UI>(
+        "sus", "Play SUS Game", "Lets play SUS Game...",
+        'S', 'U', search_engine<char>(9)),
+        { 9, 72, 504, 3024, 15120, 60480, 181440, 362880, 362880 });
+    games.add(make_game_entry<char, TicTacToe5x5, TicTacToe5x5_UI>(
+        "5x5", "Play 5x5 Tic-Tac-Toe", "Starting 5x5 Tic-Tac-Toe...",
+        'X', 'O', mcts_engine<char, TicTacToe5x5>(search_engine<char>(6, true))),
+        { 25, 600, 13800, 303600, 6375600 });
+    games.add(make_game_entry<char, WordTicTacToe_Board, WordTicTacToe_UI>(
+        "word", "Play Word Tic-Tac-Toe", "Starting Word Tic-Tac-Toe...",
+        'X', 'O', mcts_engine<char, WordTicTacToe_Board>(search_engine<char>(2))),
+        { 234, 48672, 8858304 });
+    games.add(make_game_entry<char, Misere_Tic_Tac_Toe_Board, Misere_Tic_Tac_Toe_UI>(
+        "misere", "Play Misere Tic Tac Toe", "Lets play Misere Tic Tac Toe Together...",
+        'X', 'O', perfect_play<char>()),
+        { 9, 72, 504, 3024, 15120, 54720, 148176, 200448, 127872 });
+    games.add(make_game_entry<char, Diamond_Tic_Tac_Toe_Board, Diamond_Tic_Tac_Toe_UI>(
+        "diamond", "Play Diamond Tic Tac Toe", "Lets play Diamond Tic Tac Toe Together...",
+        'X', 'O', search_engine<char>(6, true)),
+        { 25, 600, 13800, 303600, 6375600, 127512000 });
+    games.add(make_game_entry<char, Tic_Tac_Toe_4x4_Board, Tic_Tac_Toe_4x4_UI>(
+        "4x4", "Play 4x4 Tic-Tac-Toe", "Starting 4x4 Tic-Tac-Toe...",
+        'X', 'O', search_engine<char>(8)),
+        { 4, 22, 150, 970, 7092, 49838, 353614, 2357482, 16299128 });
+    games.add(make_game_entry<char, Pyramid_Tic_Tac_Toe_Board, Pyramid_Tic_Tac_Toe_UI>(
+        "pyramid", "Play pyramid_Tic_Tac_Toe", "Lets play Pyramid_Tic_Tac_Toe Together...",
+        'X', 'O', perfect_play<char>()),
+        { 9, 72, 504, 3024, 15120, 55440, 152712, 228384, 171648 });
+    games.add(make_game_entry<int, Numerical_Board, Numerical_UI>(
+        "numerical", "Play Numerical Tic-Tac-Toe", "Launching Numerical Tic-Tac-Toe...",
+        1, 2, search_engine<int>(9)),
+        { 45, 1440, 40320, 725760, 10471680 });
+    games.add(make_game_entry<char, Obstacles_Tic_Tac_Toe_Board, Obstacles_Tic_Tac_Toe_UI>(
+        "obstacles", "Play Obstacles Tic-Tac-Toe", "Lets play Obstacles Tic Tac Toe Together...",
+        'X', 'O', mcts_engine<char, Obstacles_Tic_Tac_Toe_Board>(search_engine<char>(5, true))));
+    games.add(make_game_entry<char, Infinity_Board, Infinity_UI>(
+        "infinity", "Play Infinity Tic-Tac-Toe", "Launching Infinity Tic-Tac-Toe...",
+        'X', 'O', search_engine<char>(12)),
+        { 9, 72, 504, 3024, 15120, 54720, 148176, 396576, 1059984 });
+    games.add(make_game_entry<char, UltimateTicTacToe_Board, UltimateTicTacToe_UI>(
+        "ultimate", "Play Ultimate Tic-Tac-Toe", "Launching Ultimate Tic-Tac-Toe...",
+        'X', 'O', mcts_engine<char, UltimateTicTacToe_Board>(search_engine<char>(8))),
+        { 81, 648, 4536, 27216, 136080 });
+    games.add(make_game_entry<char, MemoryTTT_Board, MemoryTTT_UI>(
+        "memory", "Play Memory_Tic_Tac_Toe", "Lets play Memory Tic Tac Toe Together...",
+        'X', 'O', perfect_play<char>()),
+        { 9, 72, 504, 3024, 15120, 54720, 148176, 200448, 127872 });
+    return games;
+}
+
+/**
+ * @brief Print the command-line usage and the names of the games.
+ */
+void print_usage(const GameRegistry& games) {
+    cerr << "Usage: game [--game NAME [--p1 ENGINE] [--p2 ENGINE] [--games N]\n"
+         << "             [--threads T] [--seed S] [--quiet] [--perft D]]\n"
+         << "With no options, shows the menu.\n\n"
+         << "  --game NAME   Variant to play:";
+    for (const GameEntry& entry : games.all())
+        cerr << " " << entry.name;
+    cerr << "\n"
+         << "  --p1, --p2    human, computer, search or ai (default: computer)\n"
+         << "  --games N     Games to play (default: 1)\n"
+         << "  --threads T   Worker threads for more than one game (default: all)\n"
+         << "  --seed S      Seed of the run (default: the clock)\n"
+         << "  --quiet       Print only the summary line\n"
+         << "  --perft D     Count the move tree at depths 1 to D instead of playing\n";
+}
+
+/**
+ * @brief Count the move tree of `entry` at each depth up to options.perft
+ * and check the counts against the known ones.
+ * @return 0 if every count with a known value matches, 1 otherwise.
+ */
+int run_perft(const GameEntry& entry, const GameOptions& options) {
+    int mismatches = 0;
+    for (int depth = 1; depth <= options.perft; ++depth) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        const uint64_t nodes = entry.perft(depth, options.threads, options.seed);
+        const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        cout << entry.name << " perft " << depth << ": " << nodes << " nodes, " << seconds << " s, "
+             << (seconds > 0 ? nodes / seconds : 0.0) << " nodes/s";
+        if (depth <= static_cast<int>(entry.perft_counts.size())) {
+            const uint64_t expected = entry.perft_counts[depth - 1];
+            if (nodes == expected) cout << ", ok";
+            else {
+                cout << ", MISMATCH (expected " << expected << ")";
+                mismatches++;
+            }
+        }
+        cout << endl;
+    }
+    return mismatches ? 1 : 0;
+}
+
+/**
+ * @brief Read the command line into `options` and the game name.
+ * @return false, after printing the reason to cerr, on an unknown or
+ * malformed option.
+ */
+bool parse_arguments(int argc, char* argv[], GameOptions& options, string& game) {
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg == "--quiet") {
+            options.quiet = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            cerr << "Missing value after " << arg << "\n";
+            return false;
+        }
+        const string value = argv[++i];
+        char* end = nullptr;
+        if (arg == "--game") game = value;
+        else if (arg == "--p1" || arg == "--p2") {
+            if (!parse_player_type(value, options.players[arg == "--p1" ? 0 : 1])) {
+                cerr << "Unknown engine '" << value << "'\n";
+                return false;
+            }
+        }
+        else if (arg == "--games") {
+            options.games = strtol(value.c_str(), &end, 10);
+            if (*end || options.games < 1) {
+                cerr << "--games needs a positive number\n";
+                return false;
+            }
+        }
+        else if (arg == "--threads") {
+            options.threads = static_cast<int>(strtol(value.c_str(), &end, 10));
+            if (*end || options.threads < 0) {
+                cerr << "--threads needs a number (0 for all)\n";
+                return false;
+            }
+        }
+        else if (arg == "--perft") {
+            options.perft = static_cast<int>(strtol(value.c_str(), &end, 10));
+            if (*end || options.perft < 1) {
+                cerr << "--perft needs a positive depth\n";
+                return false;
+            }
+        }
+        else if (arg == "--seed") {
+            options.seed = strtoull(value.c_str(), &end, 10);
+            if (*end) {
+                cerr << "--seed needs a number\n";
+                return false;
+            }
+        }
+        else {
+            cerr << "Unknown option " << arg << "\n";
+            return false;
+        }
+    }
+    if (game.empty()) {
+        cerr << "--game is required with other options\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Main function: the game selection menu, or one run from the
+ * command line.
  *
- * @note Seeds random number generator at startup for computer players
- * @note Invalid menu choices display error message and exit
+ * With no arguments, displays a menu of the registered games, sets up
+ * the chosen one with its players on stdin and runs it to completion.
  *
- * Example usage flow:
+ * With arguments (see print_usage()), plays the game named by --game
+ * without asking anything: one game shown on the terminal, or, with
+ * --games or --quiet, a Tournament on --threads workers that prints one
+ * summary line, for example:
  * @code
- * // User runs program
- * $ ./game
- *
- * // Sees menu
- * Welcome to FCAI Board Games...
- * Menu:
- *   1. Play Four-in-a-Row
- *   ...
- * Enter your choice: 3
- *
- * // Game initializes
- * Starting 5x5 Tic-Tac-Toe...
- * Setup players...
- *
- * // Game runs
- * [Game plays out]
- *
- * // Cleanup and exit
- * Thank you for playing!
+ * $ ./game --game four-in-a-row --p1 search --p2 computer --games 200 --seed 7
+ * four-in-a-row: 200 games, Player 1 wins 200, Player 2 wins 0, draws 0, 2222 moves, ...
  * @endcode
+ *
+ * @return 0 on success, 1 on bad arguments or options the game cannot
+ * play
  */
-int main() {
-    // Seed random number generator for computer players
-    srand(static_cast<unsigned int>(time(0)));
+int main(int argc, char* argv[]) {
+    const GameRegistry games = game_registry();
+
+    if (argc > 1) {
+        GameOptions options;
+        // Session seed; each game derives the board and player engines from it
+        options.seed = static_cast<uint64_t>(time(0));
+        string name;
+        if (!parse_arguments(argc, argv, options, name)) {
+            print_usage(games);
+            return 1;
+        }
+        const GameEntry* entry = games.find(name);
+        if (!entry) {
+            cerr << "Unknown game '" << name << "'\n";
+            print_usage(games);
+            return 1;
+        }
+        return options.perft ? run_perft(*entry, options) : entry->play(options);
+    }
+
+    // Session seed; each GameManager derives the board and player engines from it
+    const uint64_t session_seed = static_cast<uint64_t>(time(0));
 
     int choice;
 
@@ -212,266 +447,18 @@ int main() {
     cout << "  Welcome to FCAI Al3ab gamda moot (Team  )" << endl;
     cout << "=============================================" << endl;
     cout << "Menu:" << endl;
-    cout << "  0. Play X-O Game (Demo)" << endl;
-    cout << "  1. Play Four-in-a-Row (Connect Four)" << endl;
-    cout << "  2. Play SUS Game" << endl;
-    cout << "  3. Play 5x5 Tic-Tac-Toe" << endl;
-    cout << "  4. Play Word Tic-Tac-Toe" << endl;
-    cout << "  5. Play Misere Tic Tac Toe" << endl;
-    cout << "  6. Play Diamond Tic Tac Toe" << endl;
-    cout << "  7. Play 4x4 Tic-Tac-Toe" << endl;
-    cout << "  8. Play pyramid_Tic_Tac_Toe" << endl;
-    cout << "  9. Play Numerical Tic-Tac-Toe" << endl;
-    cout << " 10. Play Obstacles Tic-Tac-Toe" << endl;
-    cout << " 11. Play Infinity Tic-Tac-Toe" << endl;
-    cout << " 12. Play Ultimate Tic-Tac-Toe" << endl;
-    cout << " 13. Play Memory_Tic_Tac_Toe" << endl;
-    cout << "  0. Exit" << endl;
+    for (size_t i = 0; i < games.all().size(); ++i)
+        cout << (i < 10 ? "  " : " ") << i << ". " << games.all()[i].title << endl;
+    cout << "  Any other number: Exit" << endl;
     cout << "---------------------------------------------" << endl;
     cout << "Enter your choice: ";
     cin >> choice;
 
-    /**
-     * @section game_handlers Game Handler Sections
-     *
-     * Each game handler follows the same pattern:
-     * 1. Display starting message
-     * 2. Create UI (handles input/output)
-     * 3. Create Board (handles game logic)
-     * 4. Setup players through UI
-     * 5. Create GameManager to orchestrate
-     * 6. Run game to completion
-     * 7. Clean up all allocated memory
-     */
-
-    if (choice == 0) {
-        cout << "\nLets play X-O Together..." << endl;
-
-        UI<char>* game_ui = new XO_UI();
-        Board<char>* xo_board = new X_O_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> x_o_game(xo_board, players, game_ui);
-
-        x_o_game.run();
-
-        delete xo_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 1) {
-        cout << "\nLets play SUS Game..." << endl;
-
-        UI<char>* game_ui = new SUS_UI();
-        Board<char>* sus_board = new SUS_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> sus_game(sus_board, players, game_ui);
-
-        sus_game.run();
-
-        delete sus_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 2) {
-        cout << "\nStarting Four-in-a-Row (Connect Four)..." << endl;
-
-        UI<char>* game_ui = new FourInARow_UI();
-        Board<char>* board = new FourInARow_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> game(board, players, game_ui);
-
-        game.run();
-
-        delete board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 3) {
-        cout << "\nStarting 5x5 Tic-Tac-Toe..." << endl;
-
-        UI<char>* game_ui = new TicTacToe5x5_UI();
-        Board<char>* board = new TicTacToe5x5();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> game(board, players, game_ui);
-
-        game.run();
-
-        delete board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 4) {
-        cout << "\nStarting Word Tic-Tac-Toe..." << endl;
-
-        UI<char>* game_ui = new WordTicTacToe_UI();
-        Board<char>* word_board = new WordTicTacToe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> word_game(word_board, players, game_ui);
-
-        word_game.run();
-
-        delete word_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 5) {
-        cout << "\nLets play Misere Tic Tac Toe Together..." << endl;
-
-        UI<char>* game_ui = new Misere_Tic_Tac_Toe_UI();
-        Board<char>* Misere_Tic_Tac_Toe_board = new Misere_Tic_Tac_Toe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> Misere_Tic_Tac_Toe_game(Misere_Tic_Tac_Toe_board, players, game_ui);
-
-        Misere_Tic_Tac_Toe_game.run();
-
-        delete Misere_Tic_Tac_Toe_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 6) {
-        cout << "\nLets play Diamond Tic Tac Toe Together..." << endl;
-
-        UI<char>* game_ui = new Diamond_Tic_Tac_Toe_UI();
-        Board<char>* Diamond_Tic_Tac_Toe_board = new Diamond_Tic_Tac_Toe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> Diamond_Tic_Tac_Toe_game(Diamond_Tic_Tac_Toe_board, players, game_ui);
-
-        Diamond_Tic_Tac_Toe_game.run();
-
-        delete Diamond_Tic_Tac_Toe_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-	}
-	else if (choice == 7) {
-		cout << "\nStarting 4x4 Tic-Tac-Toe..." << endl;
-
-		UI<char>* game_ui = new Tic_Tac_Toe_4x4_UI();
-		Board<char>* Tic_Tac_Toe_4x4_board = new Tic_Tac_Toe_4x4_Board();
-		Player<char>** players = game_ui->setup_players();
-		GameManager<char> Tic_Tac_Toe_4x4_game(Tic_Tac_Toe_4x4_board, players, game_ui);
-
-        Tic_Tac_Toe_4x4_game.run();
-
-		delete Tic_Tac_Toe_4x4_board;
-		delete players[0];
-		delete players[1];
-		delete[] players;
-		delete game_ui;
-		}
-    else if (choice == 8) {
-        cout << "\nLets play Pyramid_Tic_Tac_Toe Together..." << endl;
-
-        UI<char>* game_ui = new Pyramid_Tic_Tac_Toe_UI();
-        Board<char>* Pyramid_Tic_Tac_Toe_board = new Pyramid_Tic_Tac_Toe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> Pyramid_Tic_Tac_Toe_game(Pyramid_Tic_Tac_Toe_board, players, game_ui);
-
-        Pyramid_Tic_Tac_Toe_game.run();
-
-        delete Pyramid_Tic_Tac_Toe_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-        }
-    else if (choice == 9) {
-        cout << "\nLaunching Numerical Tic-Tac-Toe..." << endl;
-
-        UI<int>* game_ui = new Numerical_UI();
-        Board<int>* num_board = new Numerical_Board();
-        Player<int>** players = game_ui->setup_players();
-        GameManager<int> num_game(num_board, players, game_ui);
-
-        num_game.run();
-
-        delete num_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 10) {
-        cout << "\nLets play Obstacles Tic Tac Toe Together..." << endl;
-
-        UI<char>* game_ui = new Obstacles_Tic_Tac_Toe_UI();
-        Board<char>* Obstacles_Tic_Tac_Toe_board = new Obstacles_Tic_Tac_Toe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> Obstacles_Tic_Tac_Toe_game(Obstacles_Tic_Tac_Toe_board, players, game_ui);
-
-        Obstacles_Tic_Tac_Toe_game.run();
-
-        delete Obstacles_Tic_Tac_Toe_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 11) {
-        cout << "\nLaunching Infinity Tic-Tac-Toe..." << endl;
-
-        UI<char>* game_ui = new Infinity_UI();
-        Board<char>* infinity_board = new Infinity_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> infinity_game(infinity_board, players, game_ui);
-
-        infinity_game.run();
-
-        delete infinity_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 12) {
-        cout << "\nLaunching Ultimate Tic-Tac-Toe..." << endl;
-
-        UI<char>* game_ui = new UltimateTicTacToe_UI();
-        Board<char>* ultimate_board = new UltimateTicTacToe_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> ultimate_game(ultimate_board, players, game_ui);
-
-        ultimate_game.run();
-
-        delete ultimate_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-    }
-    else if (choice == 13) {
-        cout << "\nLets play Memory Tic Tac Toe Together..." << endl;
-
-        UI<char>* game_ui = new MemoryTTT_UI();
-        Board<char>* memory_board = new MemoryTTT_Board();
-        Player<char>** players = game_ui->setup_players();
-        GameManager<char> memory_game(memory_board, players, game_ui);
-
-        memory_game.run();
-
-        delete memory_board;
-        delete players[0];
-        delete players[1];
-        delete[] players;
-        delete game_ui;
-        }
-    else if (choice != 0) {
+    if (cin && choice >= 0 && choice < static_cast<int>(games.all().size()))
+        games.all()[choice].play_interactive(session_seed);
+    else
         cout << "Invalid choice. Exiting." << endl;
-    }
 
     cout << "\nThank you for playing!" << endl;
     return 0;
-}
\ No newline at end of file
+}
@@ -1,14 +1,31 @@
 #include "MemoryTTT_Classes.h"
+#include "WinLines.h"
+#include "NineCellTable.h"
 #include <iostream>
 
-MemoryTTT_Board::MemoryTTT_Board() : Board<char>(3, 3) {
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            this->board[i][j] = blank_symbol;
-        }
-    }
-    display_board = vector<vector<char>>(3, vector<char>(3, '?'));
+// Rows, columns and diagonals of the 3x3 board, as masks over marks_of()
+static constexpr WinLines<3, 3, 3> memory_lines;
+
+MemoryTTT_Board::MemoryTTT_Board() : XOBoardBase(3, 3), display_board(3, 3, '?') {
+    this->zobrist = ZobristKeys(3, 3, 2);
+    reset();
+}
+
+void MemoryTTT_Board::reset() {
+    this->board.fill(blank_symbol);
+    display_board.fill('?');
     this->n_moves = 0;
+    this->hash = 0;
+    this->marks[0] = this->marks[1] = 0;
+    history.clear();
+}
+
+void MemoryTTT_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (this->board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool MemoryTTT_Board::update_board(Move<char>* move) {
@@ -22,41 +39,24 @@ bool MemoryTTT_Board::update_board(Move<char>* move) {
     this->board[x][y] = symbol;
     display_board[x][y] = '?';
     this->n_moves++;
+    this->hash_xo_move(x, y, symbol);
+    history.push_back({ x, y });
     return true;
 }
 
-bool MemoryTTT_Board::is_win(Player<char>* player) {
-    char symbol = player->get_symbol();
-
-    for (int i = 0; i < 3; i++) {
-        if (this->board[i][0] == symbol &&
-            this->board[i][1] == symbol &&
-            this->board[i][2] == symbol) {
-            return true;
-        }
-    }
-
-    for (int j = 0; j < 3; j++) {
-        if (this->board[0][j] == symbol &&
-            this->board[1][j] == symbol &&
-            this->board[2][j] == symbol) {
-            return true;
-        }
-    }
-
-    if (this->board[0][0] == symbol &&
-        this->board[1][1] == symbol &&
-        this->board[2][2] == symbol) {
-        return true;
-    }
+bool MemoryTTT_Board::undo_move() {
+    if (history.empty()) return false;
 
-    if (this->board[0][2] == symbol &&
-        this->board[1][1] == symbol &&
-        this->board[2][0] == symbol) {
-        return true;
-    }
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    this->hash_xo_move(cell.first, cell.second, this->board[cell.first][cell.second]);
+    this->board[cell.first][cell.second] = blank_symbol;
+    this->n_moves--;
+    return true;
+}
 
-    return false;
+bool MemoryTTT_Board::is_win(Player<char>* player) {
+    return memory_lines.any(this->marks_of(player->get_symbol()));
 }
 
 bool MemoryTTT_Board::is_draw(Player<char>* player) {
@@ -68,31 +68,40 @@ bool MemoryTTT_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome MemoryTTT_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (memory_lines.completes(x, y, this->marks_of(this->board[x][y])))
+        return Outcome::WIN;
+    return this->n_moves >= 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
+bool MemoryTTT_Board::perfect_move(char symbol, Move<char>& move) const {
+    static const NineCellTable table(memory_lines.all, memory_lines.COUNT, 0x1FF, Outcome::WIN, Outcome::DRAW);
+    return table.best_move(this->marks[0], this->marks[1], symbol, this->columns, move);
+}
+
 MemoryTTT_UI::MemoryTTT_UI() : UI<char>("=== Memory Tic-Tac-Toe ===", 3) {
     cout << "Marks are hidden after placement. Remember where you played!\n\n";
 }
 
 Player<char>* MemoryTTT_UI::create_player(string& name, char symbol, PlayerType type) {
-    if (type == PlayerType::COMPUTER) {
-        return new MemoryTTT_AI_Player(name, symbol);
-    }
-    return new Player<char>(name, symbol, type);
+    Player<char>* player = new Player<char>(name, symbol, type);
+    // Nine cells are few enough to solve every position up front, so the
+    // computer's perfect move is a table lookup rather than a search
+    if (type == PlayerType::COMPUTER)
+        player->set_strategy(new PerfectPlayStrategy<char>());
+    return player;
 }
 
-Move<char>* MemoryTTT_UI::get_move(Player<char>* player) {
-    MemoryTTT_AI_Player* ai_player = dynamic_cast<MemoryTTT_AI_Player*>(player);
-    if (ai_player) {
-        return ai_player->get_best_move();
-    }
-
+Move<char> MemoryTTT_UI::get_move(Player<char>* player) {
     cout << player->get_name() << "'s turn (symbol: " << player->get_symbol() << ")\n";
     int x, y;
     cout << "Enter position (row col): ";
     cin >> x >> y;
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
 
-void MemoryTTT_UI::display_board_matrix(const vector<vector<char>>& matrix) const {
+void MemoryTTT_UI::display_board_matrix(const BoardView<char>& matrix) const {
     cout << "\n";
     cout << "    0   1   2\n";
     cout << "  +---+---+---+\n";
@@ -109,7 +118,7 @@ void MemoryTTT_UI::display_memory_board(MemoryTTT_Board* board) {
 
 Player<char>** MemoryTTT_UI::setup_players() {
     Player<char>** players = new Player<char>*[2];
-    vector<string> type_options = { "Human", "Computer (AI)" };
+    vector<string> type_options = { "Human", "Computer (AI)", "Search AI" };
 
     string nameX = this->get_player_name("Player X");
     PlayerType typeX = this->get_player_type_choice("Player X", type_options);
@@ -2,16 +2,36 @@
 #include <iomanip>
 #include <cctype>  
 #include "Misere_Tic_Tac_Toe.h"
+#include "WinLines.h"
+#include "NineCellTable.h"
 
 using namespace std;
 
+// Rows, columns and diagonals of the 3x3 board, as masks over marks_of()
+static constexpr WinLines<3, 3, 3> misere_lines;
 
 
-Misere_Tic_Tac_Toe_Board::Misere_Tic_Tac_Toe_Board() : Board(3, 3) {
+
+Misere_Tic_Tac_Toe_Board::Misere_Tic_Tac_Toe_Board() : XOBoardBase(3, 3) {
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void Misere_Tic_Tac_Toe_Board::reset() {
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    board.fill(blank_symbol);
+    history.clear();
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+}
+
+void Misere_Tic_Tac_Toe_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool Misere_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
@@ -21,37 +41,30 @@ bool Misere_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
 
     // Validate move and apply if valid
     if (!(x < 0 || x >= rows || y < 0 || y >= columns) &&
-        (board[x][y] == blank_symbol || mark == 0)) {
-
-        if (mark == 0) { // Undo move
-            n_moves--;
-            board[x][y] = blank_symbol;
-        }
-        else {         // Apply move
-            n_moves++;
-            board[x][y] = toupper(mark);
-        }
+        (board[x][y] == blank_symbol)) {
+
+        n_moves++;
+        board[x][y] = toupper(mark);
+        hash_xo_move(x, y, board[x][y]);
+        history.push_back({ x, y });
         return true;
     }
     return false;
 }
 
-bool Misere_Tic_Tac_Toe_Board::is_lose(Player<char>* player) {
-    const char sym = player->get_symbol();
-
-    auto all_equal = [&](char a, char b, char c) {
-        return (a == b && b == c && a == sym);
-        };
-
-    for (int i = 0; i < 3; ++i) {
-        if (all_equal(board[i][0], board[i][1], board[i][2])) return true;
-        if (all_equal(board[0][i], board[1][i], board[2][i])) return true;
-    }
+bool Misere_Tic_Tac_Toe_Board::undo_move() {
+    if (history.empty()) return false;
 
-    if (all_equal(board[0][0], board[1][1], board[2][2])) return true;
-    if (all_equal(board[0][2], board[1][1], board[2][0])) return true;
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
 
-    return false;
+bool Misere_Tic_Tac_Toe_Board::is_lose(Player<char>* player) {
+    return misere_lines.any(marks_of(player->get_symbol()));
 }
 
 bool Misere_Tic_Tac_Toe_Board::is_draw(Player<char>* player) {
@@ -66,6 +79,18 @@ bool Misere_Tic_Tac_Toe_Board::game_is_over(Player<char>* player) {
     return is_lose(player) || is_win(player);
 }
 
+Outcome Misere_Tic_Tac_Toe_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (misere_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::LOSS;
+    return n_moves == 9 ? Outcome::WIN : Outcome::ONGOING;
+}
+
+bool Misere_Tic_Tac_Toe_Board::perfect_move(char symbol, Move<char>& move) const {
+    static const NineCellTable table(misere_lines.all, misere_lines.COUNT, 0x1FF, Outcome::LOSS, Outcome::WIN);
+    return table.best_move(marks[0], marks[1], symbol, columns, move);
+}
+
 
 
 Misere_Tic_Tac_Toe_UI::Misere_Tic_Tac_Toe_UI() : UI<char>("Weclome to FCAI Misere Tic Tac Toe Game by Dr El-Ramly", 3) {}
@@ -78,16 +103,10 @@ Player<char>* Misere_Tic_Tac_Toe_UI::create_player(string& name, char symbol, Pl
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Misere_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
+Move<char> Misere_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
     int x, y;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\nPlease enter your move x and y (0 to 2): ";
-        cin >> x >> y;
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        x = rand() % player->get_board_ptr()->get_rows();
-        y = rand() % player->get_board_ptr()->get_columns();
-    }
-    return new Move<char>(x, y, player->get_symbol());
+    cout << "\nPlease enter your move x and y (0 to 2): ";
+    cin >> x >> y;
+    return Move<char>(x, y, player->get_symbol());
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #define Misere_Tic_Tac_Toe_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 using namespace std;
 
 /**
@@ -37,9 +38,10 @@ using namespace std;
  *
  * @see Board
  */
-class Misere_Tic_Tac_Toe_Board : public Board<char> {
+class Misere_Tic_Tac_Toe_Board final : public XOBoardBase {
 private:
     char blank_symbol = '.'; ///< Character representing empty cells
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 
 public:
     /**
@@ -104,6 +106,38 @@ public:
      * @return true if game over, false if game continues
      */
     bool game_is_over(Player<char>* player);
+
+    /**
+     * @brief Checks only the lines through the cell `last_move` filled.
+     * @param last_move The move just applied.
+     * @return LOSS if the mover made three in a row, WIN if that filled
+     *         the board without one, else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to all blank cells.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new Misere_Tic_Tac_Toe_Board(*this); }
+
+    /** @brief The perfect-play move for `symbol`, looked up in a table of every position. */
+    bool perfect_move(char symbol, Move<char>& move) const override;
+
+    /**
+     * @brief Lists every empty cell as a move for `symbol`.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 };
 
 /**
@@ -142,19 +176,15 @@ public:
     Player<char>* create_player(string& name, char symbol, PlayerType type);
 
     /**
-     * @brief Gets a move from a player.
+     * @brief Gets a move from a human player.
      *
-     * For human players:
      * - Prompts "enter x and y (0 to 2)"
      * - Reads row and column input
      *
-     * For computer players:
-     * - Randomly selects position within bounds
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move object with position and symbol
+     * @return Move object with position and symbol
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 };
 
 #endif // Misere_Tic_Tac_Toe_H
\ No newline at end of file
@@ -0,0 +1,416 @@
+/**
+ * @file NegamaxEngine.h
+ * @brief Game-independent alpha-beta search usable as any player's strategy.
+ *
+ * This file provides:
+ * - `NegamaxEngine`: Iterative-deepening negamax with alpha-beta pruning,
+ *   aspiration windows, a transposition table and principal-variation,
+ *   killer and history move ordering, optionally spread over several
+ *   threads with Lazy SMP.
+ *
+ * The engine only talks to the board through the Board<T> interface:
+ * generate_moves(), update_board() and undo_move() to make and unmake
+ * moves on the live board, evaluate_outcome() to detect the end of the
+ * game, evaluate_position() at the search horizon, other_symbol() for the
+ * side to move and get_hash() for the table. Any game that implements
+ * those gets a searching AI by attaching an engine to a player:
+ *
+ * @code
+ * player->set_strategy(new NegamaxEngine<char>(6));
+ * @endcode
+ *
+ * Helper threads search their own Board::clone() of the position. Random
+ * events are switched off for the search (see ChanceFreeSearch), so it
+ * neither foresees nor hashes what the board's dice will do.
+ */
+
+#ifndef NEGAMAX_ENGINE_H
+#define NEGAMAX_ENGINE_H
+
+#include "BoardGame_Classes.h"
+#include "TranspositionTable.h"
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+using namespace std;
+
+/**
+ * @class NegamaxEngine
+ * @brief Depth-limited alpha-beta search over any Board<T>.
+ *
+ * @tparam T Type of symbol placed on the board.
+ * @tparam B Board class searched. Defaults to Board<T>; naming the concrete
+ * board lets the compiler call its methods directly instead of virtually.
+ * choose_move() must then only be given boards of that class.
+ *
+ * Scores are from the point of view of the side to move. A won game scores
+ * MATE minus the number of moves to reach it, so quicker wins are
+ * preferred and slower losses resisted; positions at the search horizon
+ * score evaluate_position().
+ *
+ * Each search deepens one ply at a time up to the depth limit. Every
+ * iteration after the first starts with a narrow window around the last
+ * score and only re-searches with the full window if the score falls
+ * outside it. Moves are tried in this order: the table's best move, the
+ * previous iteration's principal variation, two killer moves per ply that
+ * recently caused cut-offs, then the rest by history score. The table is
+ * kept between searches, so later moves of a game start from what earlier
+ * searches learnt.
+ *
+ * With more than one thread the engine runs Lazy SMP: helper threads run
+ * the same iterative deepening on copies of the board while the calling
+ * thread searches, sharing nothing but the transposition table. Odd
+ * helpers start one ply deeper than the others, so at any moment some
+ * thread is filling the table for the depth the calling thread reaches
+ * next. The move played is always the calling thread's; the helpers are
+ * stopped when it finishes and their unfinished work is thrown away.
+ *
+ * The depth limit can be combined with a per-move budget (see
+ * MoveStrategy::set_limits) of time or of positions visited by the
+ * calling thread, and with a CancelToken. Once the first iteration is
+ * done, whichever runs out first stops the search, and the move of the
+ * last completed iteration is played. For a purely time-limited search
+ * give the engine a depth limit of MAX_PLY - 1.
+ *
+ * When pondering (see MoveStrategy::ponder) the engine expects the second
+ * move of its principal variation as the reply, or the table's best move
+ * after its own when a table hit cut the variation short. If the opponent
+ * plays it, the next search finds the pondered results in the table and
+ * finishes almost at once.
+ */
+template <typename T, typename B = Board<T>>
+class NegamaxEngine : public MoveStrategy<T> {
+public:
+    static const int MATE = 30000;  ///< Score of a win on the spot
+    static const int MAX_PLY = 64;  ///< Deepest ply the search can reach
+
+private:
+    static const int INF = MATE + 1;
+    static const int ASPIRATION_WINDOW = 16; ///< Half-width of the first window, in evaluate_position() units
+    static const int HISTORY_SIZE = 4096;     ///< Slots in the history table (a power of two)
+    static const uint8_t NO_MOVE = 0xFF;      ///< Table entry without a best move
+
+    /** @brief A searched position: its score, how deep, and the best move's index in generate_moves() order. */
+    struct SearchEntry {
+        int16_t score;
+        uint8_t depth;
+        Bound bound;
+        uint8_t move;
+    };
+
+    /** @brief Move ordering and results of one search thread. */
+    struct SearchThread {
+        Move<T> killers[MAX_PLY][2];    ///< Moves that last caused a cut-off, per ply
+        int history[HISTORY_SIZE];      ///< Cut-off counts weighted by depth, per move
+        Move<T> pv[MAX_PLY][MAX_PLY];   ///< Principal variation found below each ply
+        int pv_length[MAX_PLY];         ///< pv[ply] holds moves ply..pv_length[ply]-1
+        vector<Move<T>> last_pv;        ///< Principal variation of the last completed iteration
+
+        long nodes = 0;                 ///< Positions visited by the last search
+        int last_score = 0;             ///< Score of the last completed iteration
+        int last_depth = 0;             ///< Depth of the last completed iteration
+        const atomic<bool>* stop = nullptr; ///< Abandon the search once this is set (helpers only)
+        bool budgeted = false;          ///< Check the engine's limits at every node
+        bool aborted = false;           ///< The limits ran out during the current iteration
+
+        SearchThread() { fill(history, history + HISTORY_SIZE, 0); }
+
+        /** @brief True once the thread has been told to give up. */
+        bool stopped() const { return aborted || (stop && stop->load(memory_order_relaxed)); }
+    };
+
+    int max_depth;                                   ///< Depth limit of each search
+    TranspositionTable<uint64_t, SearchEntry> table; ///< Positions searched so far, shared by all threads
+    SearchThread main_thread;                        ///< State of the calling thread's search
+    vector<unique_ptr<SearchThread>> helpers;        ///< State of each Lazy SMP helper thread
+    atomic<bool> stop_helpers;                       ///< Set when the calling thread's search is done
+    SearchDeadline deadline;                         ///< Time limit and cancel token of the current search
+    bool has_reply = false;                          ///< expected_reply is set
+    Move<T> expected_reply;                          ///< Opponent's expected answer to the last move chosen
+
+    /** @brief True once the calling thread has used up the per-move budget, after `nodes` positions. */
+    bool out_of_budget(long nodes) const {
+        if (this->limits.nodes > 0 && nodes >= this->limits.nodes) return true;
+        return (nodes & 1023) == 0 && deadline.passed();
+    }
+
+    /** @brief History table slot of a move. */
+    static int history_index(const Move<T>& m) {
+        unsigned h = static_cast<unsigned>(m.get_x() * 7 + m.get_y());
+        h = h * 31 + static_cast<unsigned>((m.get_from_x() + 1) * 7 + (m.get_from_y() + 1));
+        h = h * 31 + static_cast<unsigned>(m.get_symbol());
+        return static_cast<int>(h & (HISTORY_SIZE - 1));
+    }
+
+    /** @brief Make win scores relative to the stored position, so they stay right at any ply. */
+    static int score_to_table(int score, int ply) {
+        if (score > MATE - MAX_PLY) return score + ply;
+        if (score < -(MATE - MAX_PLY)) return score - ply;
+        return score;
+    }
+
+    /** @brief Undo score_to_table() for a position found at `ply`. */
+    static int score_from_table(int score, int ply) {
+        if (score > MATE - MAX_PLY) return score - ply;
+        if (score < -(MATE - MAX_PLY)) return score + ply;
+        return score;
+    }
+
+    /** @brief Ordering keys for the moves of one position; bigger is tried first. */
+    static void score_moves(const SearchThread& s, const MoveList<T>& moves, int* keys, int tt_move,
+        bool on_pv, int ply) {
+        for (int i = 0; i < moves.size(); ++i) {
+            const Move<T>& m = moves[i];
+            if (i == tt_move)
+                keys[i] = 1 << 30;
+            else if (on_pv && ply < static_cast<int>(s.last_pv.size()) && m == s.last_pv[ply])
+                keys[i] = 1 << 29;
+            else if (m == s.killers[ply][0])
+                keys[i] = 1 << 28;
+            else if (m == s.killers[ply][1])
+                keys[i] = 1 << 27;
+            else
+                keys[i] = s.history[history_index(m)];
+        }
+    }
+
+    /** @brief Index of the best-keyed move not yet tried, marking it tried. */
+    static int pick_next(int* keys, int count) {
+        int best = 0;
+        for (int i = 1; i < count; ++i)
+            if (keys[i] > keys[best]) best = i;
+        keys[best] = -1;
+        return best;
+    }
+
+    /**
+     * @brief Negamax search of the current position.
+     *
+     * @param side Symbol of the player to move.
+     * @param depth Plies left before the horizon.
+     * @param ply Plies from the root.
+     * @param on_pv True while every move from the root followed the last principal variation.
+     * @return Score for `side`; only exact inside (alpha, beta). Meaningless
+     * once s.stopped(), and then nothing is stored in the table.
+     */
+    int negamax(B& board, SearchThread& s, T side, int depth, int ply, int alpha, int beta, bool on_pv) {
+        ++s.nodes;
+        if (s.budgeted && out_of_budget(s.nodes)) {
+            s.aborted = true;
+            return 0;
+        }
+        s.pv_length[ply] = ply;
+
+        const uint64_t key = board.get_hash();
+        int tt_move = NO_MOVE;
+        SearchEntry entry;
+        if (table.probe(key, entry)) {
+            tt_move = entry.move;
+            if (ply > 0 && entry.depth >= depth) {
+                int score = score_from_table(entry.score, ply);
+                if (entry.bound == Bound::EXACT) return score;
+                if (entry.bound == Bound::LOWER && score >= beta) return score;
+                if (entry.bound == Bound::UPPER && score <= alpha) return score;
+            }
+        }
+        if (depth == 0 || ply >= MAX_PLY - 1)
+            return board.evaluate_position(side);
+
+        MoveList<T> moves;
+        board.generate_moves(side, moves);
+        if (moves.empty()) return 0;
+
+        int keys[MoveList<T>::CAPACITY];
+        score_moves(s, moves, keys, tt_move, on_pv, ply);
+
+        const int alpha_in = alpha;
+        int best = -INF;
+        int best_index = NO_MOVE;
+        for (int n = 0; n < moves.size(); ++n) {
+            int i = pick_next(keys, moves.size());
+            Move<T> m = moves[i];
+            if (!board.update_board(&m)) continue;
+
+            s.pv_length[ply + 1] = ply + 1;
+            int score;
+            switch (board.evaluate_outcome(m)) {
+            case Outcome::WIN:  score = MATE - (ply + 1); break;
+            case Outcome::LOSS: score = -(MATE - (ply + 1)); break;
+            case Outcome::DRAW: score = 0; break;
+            default:
+                score = -negamax(board, s, board.other_symbol(side), depth - 1, ply + 1, -beta, -alpha,
+                    on_pv && ply < static_cast<int>(s.last_pv.size()) && m == s.last_pv[ply]);
+            }
+            board.undo_move();
+            if (s.stopped()) return 0;
+
+            if (score > best) {
+                best = score;
+                best_index = i;
+                if (score > alpha) {
+                    alpha = score;
+                    s.pv[ply][ply] = m;
+                    for (int k = ply + 1; k < s.pv_length[ply + 1]; ++k)
+                        s.pv[ply][k] = s.pv[ply + 1][k];
+                    s.pv_length[ply] = s.pv_length[ply + 1];
+                }
+                if (alpha >= beta) {
+                    if (i != tt_move && m != s.killers[ply][0]) {
+                        s.killers[ply][1] = s.killers[ply][0];
+                        s.killers[ply][0] = m;
+                    }
+                    s.history[history_index(m)] += depth * depth;
+                    break;
+                }
+            }
+        }
+
+        entry.score = static_cast<int16_t>(score_to_table(best, ply));
+        entry.depth = static_cast<uint8_t>(depth);
+        entry.bound = best <= alpha_in ? Bound::UPPER : (best >= beta ? Bound::LOWER : Bound::EXACT);
+        entry.move = static_cast<uint8_t>(best_index);
+        table.store(key, entry);
+        return best;
+    }
+
+    /**
+     * @brief Iterative deepening from `first_depth` to the depth limit.
+     * @param best Move to return if no iteration completes.
+     * @param budgeted Stop when the per-move budget runs out, once an iteration is complete.
+     * @return First move of the last completed iteration's principal variation.
+     */
+    Move<T> deepen(B& board, SearchThread& s, T symbol, int first_depth, Move<T> best, bool budgeted) {
+        s.nodes = 0;
+        s.budgeted = false;
+        s.aborted = false;
+        s.last_pv.clear();
+        for (auto& k : s.killers) k[0] = k[1] = Move<T>();
+        for (int& h : s.history) h /= 8;
+
+        for (int depth = first_depth; depth <= max_depth; ++depth) {
+            int score;
+            if (depth > 1 && abs(s.last_score) < MATE - MAX_PLY) {
+                int alpha = s.last_score - ASPIRATION_WINDOW, beta = s.last_score + ASPIRATION_WINDOW;
+                score = negamax(board, s, symbol, depth, 0, alpha, beta, true);
+                if (!s.stopped() && (score <= alpha || score >= beta))
+                    score = negamax(board, s, symbol, depth, 0, -INF, INF, true);
+            }
+            else {
+                score = negamax(board, s, symbol, depth, 0, -INF, INF, true);
+            }
+            if (s.stopped()) break;
+
+            s.last_score = score;
+            s.last_depth = depth;
+            s.last_pv.assign(s.pv[0], s.pv[0] + s.pv_length[0]);
+            if (!s.last_pv.empty()) best = s.last_pv[0];
+            s.budgeted = budgeted;
+
+            // Nothing deeper can beat a forced win
+            if (score > MATE - MAX_PLY) break;
+        }
+        return best;
+    }
+
+    /**
+     * @brief The table's best move for the opponent after `move`, the
+     * expected reply when the principal variation stops at the root.
+     */
+    bool table_reply(B& board, Move<T> move, T symbol, Move<T>& reply) {
+        if (!board.update_board(&move)) return false;
+        SearchEntry entry;
+        bool found = board.evaluate_outcome(move) == Outcome::ONGOING
+            && table.probe(board.get_hash(), entry) && entry.move != NO_MOVE;
+        if (found) {
+            MoveList<T> moves;
+            board.generate_moves(board.other_symbol(symbol), moves);
+            found = entry.move < moves.size();
+            if (found) reply = moves[entry.move];
+        }
+        board.undo_move();
+        return found;
+    }
+
+protected:
+    /** @brief The opponent's move expected after the last move chosen. */
+    bool predict_reply(Move<T>& reply) const override {
+        if (has_reply) reply = expected_reply;
+        return has_reply;
+    }
+
+public:
+    /**
+     * @brief Create an engine.
+     * @param max_depth Plies searched per move (1 to MAX_PLY - 1).
+     * @param table_mb Size of the transposition table in MB.
+     * @param threads Search threads, the calling thread included (at least 1).
+     */
+    explicit NegamaxEngine(int max_depth = 6, size_t table_mb = 16, int threads = 1)
+        : max_depth(max(1, min(max_depth, MAX_PLY - 1))), table(table_mb), stop_helpers(false),
+          deadline(SearchLimits(), nullptr) {
+        for (int t = 1; t < threads; ++t) {
+            helpers.emplace_back(new SearchThread());
+            helpers.back()->stop = &stop_helpers;
+        }
+    }
+
+    /** @brief Destroy the engine, stopping any pondering first. */
+    ~NegamaxEngine() { this->stop_pondering(); }
+
+    /**
+     * @brief Search the board's position and return the best move found
+     * for `symbol` within the depth limit and budget, leaving the board as
+     * it was.
+     */
+    Move<T> choose_move(Board<T>& board, T symbol) override {
+        B& b = static_cast<B&>(board);
+        ChanceFreeSearch<T> chance_free(b);
+        MoveList<T> moves;
+        b.generate_moves(symbol, moves);
+        if (moves.empty()) return Move<T>();
+
+        deadline = SearchDeadline(this->limits, this->cancel_token);
+        stop_helpers.store(false, memory_order_relaxed);
+        vector<unique_ptr<Board<T>>> copies;
+        vector<thread> workers;
+        for (size_t i = 0; i < helpers.size(); ++i) {
+            copies.emplace_back(b.clone());
+            B& copy = static_cast<B&>(*copies.back());
+            SearchThread& s = *helpers[i];
+            const int first_depth = min(max_depth, 1 + static_cast<int>((i + 1) % 2));
+            const Move<T> first = moves[0];
+            workers.emplace_back([this, &copy, &s, symbol, first_depth, first]() {
+                deepen(copy, s, symbol, first_depth, first, false);
+            });
+        }
+        Move<T> best = deepen(b, main_thread, symbol, 1, moves[0], true);
+        stop_helpers.store(true, memory_order_relaxed);
+        for (thread& worker : workers) worker.join();
+
+        has_reply = main_thread.last_pv.size() >= 2;
+        if (has_reply)
+            expected_reply = main_thread.last_pv[1];
+        else
+            has_reply = table_reply(b, best, symbol, expected_reply);
+        return best;
+    }
+
+    /** @brief Score of the last search, for the side that moved. */
+    int get_score() const { return main_thread.last_score; }
+
+    /** @brief Depth the last search completed. */
+    int get_depth() const { return main_thread.last_depth; }
+
+    /** @brief Positions visited by the last search, over all threads. */
+    long get_nodes() const {
+        long total = main_thread.nodes;
+        for (const auto& s : helpers) total += s->nodes;
+        return total;
+    }
+
+    /** @brief Expected line of play found by the last search, starting with the chosen move. */
+    const vector<Move<T>>& get_pv() const { return main_thread.last_pv; }
+};
+
+#endif // NEGAMAX_ENGINE_H
@@ -0,0 +1,195 @@
+/**
+ * @file NineCellTable.h
+ * @brief Every position of a nine-cell game, solved once and looked up.
+ *
+ * This file provides:
+ * - `SolvedPosition`: What the table knows about one position.
+ * - `NineCellTable`: All 3^9 fillings of nine cells with blank, X or O,
+ *   for each side to move, with the outcome so far and a best move under
+ *   perfect play.
+ * - `PerfectPlayStrategy`: A MoveStrategy that plays the table's move.
+ *
+ * X-O, Misere, Memory Tic-Tac-Toe and the pyramid's nine cells are small
+ * enough to solve outright, so their computer players answer with one
+ * lookup instead of a search.
+ */
+
+#ifndef NINE_CELL_TABLE_H
+#define NINE_CELL_TABLE_H
+
+#include <vector>
+#include <cstdint>
+#include "BoardGame_Classes.h"
+
+using namespace std;
+
+/**
+ * @brief One position of a nine-cell game, solved.
+ */
+struct SolvedPosition {
+    Outcome outcome = Outcome::ONGOING; ///< evaluate_outcome() for the player who just moved
+    int8_t value = 0;   ///< Perfect-play result for the side to move: 1 win, 0 draw, -1 loss
+    int8_t best = -1;   ///< Table cell (0-8) of a perfect move; -1 once the game is over
+    uint8_t plies = 0;  ///< Moves left in the game with perfect play from both sides
+};
+
+/**
+ * @class NineCellTable
+ * @brief Outcome and perfect move of every position of a game where two
+ * players take turns placing marks on nine cells.
+ *
+ * A position is a pair of mark bitboards in the board's own numbering
+ * (see XOBoardBase::marks_of()); the table gathers the nine playable bits
+ * into a base-3 index. The game ends when a player completes one of the
+ * given lines or the cells are full, and the rule set says what each
+ * ending means for the player who just moved, so misere rules are one more
+ * table, not another solver.
+ *
+ * Wins are taken as soon as possible and losses put off as long as
+ * possible. Positions that legal play never reaches are filled in too,
+ * so every lookup is valid. The table takes about 300 KB; build it once,
+ * for example as a function-local static on first use.
+ */
+class NineCellTable {
+public:
+    static const int SIZE = 19683; ///< 3^9 positions per side to move
+
+private:
+    int cells[9];                    ///< Board bit of each table cell
+    vector<SolvedPosition> solved;   ///< [x_to_move * SIZE + index]
+    vector<uint64_t> lines;          ///< Winning lines, as board bitmasks
+    Outcome on_line;                 ///< Outcome for a player who completes a line
+    Outcome on_full;                 ///< Outcome for the player who fills the last cell without one
+
+    static int score(Outcome outcome) {
+        return outcome == Outcome::WIN ? 1 : outcome == Outcome::LOSS ? -1 : 0;
+    }
+
+    bool has_line(uint64_t marks) const {
+        bool found = false;
+        for (uint64_t line : lines)
+            found |= (marks & line) == line;
+        return found;
+    }
+
+    /** @brief Solve (x_marks, o_marks) with memoisation; x_to_move says whose turn it is. */
+    const SolvedPosition& solve(uint64_t x_marks, uint64_t o_marks, bool x_to_move) {
+        SolvedPosition& entry = solved[x_to_move * SIZE + index(x_marks, o_marks)];
+        // Solved already: a finished game has its outcome, an unfinished one a best move
+        if (entry.outcome != Outcome::ONGOING || entry.best != -1) return entry;
+
+        const uint64_t mover = x_to_move ? o_marks : x_marks;
+        const uint64_t waiting = x_to_move ? x_marks : o_marks;
+        if (has_line(mover)) entry.outcome = on_line;
+        else if (has_line(waiting)) entry.outcome = on_line == Outcome::WIN ? Outcome::LOSS : Outcome::WIN;
+        else if (((x_marks | o_marks) & all_cells()) == all_cells()) entry.outcome = on_full;
+
+        if (entry.outcome != Outcome::ONGOING) {
+            entry.value = static_cast<int8_t>(-score(entry.outcome));
+            return entry;
+        }
+
+        int best_value = -2, best_plies = 0, best_cell = -1;
+        for (int c = 0; c < 9; ++c) {
+            const uint64_t bit = uint64_t(1) << cells[c];
+            if ((x_marks | o_marks) & bit) continue;
+            const SolvedPosition& child = x_to_move ? solve(x_marks | bit, o_marks, false)
+                                                    : solve(x_marks, o_marks | bit, true);
+            const int value = -child.value;
+            const int plies = child.plies + 1;
+            // Among equal results, win fastest and lose slowest
+            bool better = value > best_value ||
+                (value == best_value && (value > 0 ? plies < best_plies : plies > best_plies));
+            if (better) {
+                best_value = value;
+                best_plies = plies;
+                best_cell = c;
+            }
+        }
+        entry.value = static_cast<int8_t>(best_value);
+        entry.plies = static_cast<uint8_t>(best_plies);
+        entry.best = static_cast<int8_t>(best_cell);
+        return entry;
+    }
+
+    uint64_t all_cells() const {
+        uint64_t mask = 0;
+        for (int c : cells) mask |= uint64_t(1) << c;
+        return mask;
+    }
+
+public:
+    /**
+     * @brief Solve every position of a rule set.
+     *
+     * @param lines Winning lines as board bitmasks, e.g. WinLines::all
+     * @param line_count Number of lines
+     * @param playable Mask of the nine playable board bits
+     * @param on_line Outcome for the player who completes a line
+     * (Outcome::LOSS under misere rules)
+     * @param on_full Outcome for the player who fills the last cell
+     * without completing a line
+     */
+    NineCellTable(const uint64_t* lines, int line_count, uint64_t playable, Outcome on_line, Outcome on_full)
+        : solved(2 * SIZE), lines(lines, lines + line_count), on_line(on_line), on_full(on_full) {
+        int n = 0;
+        for (int bit = 0; bit < 64 && n < 9; ++bit)
+            if (playable >> bit & 1) cells[n++] = bit;
+
+        for (int i = 0; i < SIZE; ++i) {
+            uint64_t x_marks = 0, o_marks = 0;
+            for (int c = 0, rest = i; c < 9; ++c, rest /= 3) {
+                if (rest % 3 == 1) x_marks |= uint64_t(1) << cells[c];
+                if (rest % 3 == 2) o_marks |= uint64_t(1) << cells[c];
+            }
+            solve(x_marks, o_marks, true);
+            solve(x_marks, o_marks, false);
+        }
+    }
+
+    /** @brief Base-3 index of a position: digit c is 0, 1 (X) or 2 (O) for table cell c. */
+    int index(uint64_t x_marks, uint64_t o_marks) const {
+        int i = 0;
+        for (int c = 8; c >= 0; --c)
+            i = i * 3 + static_cast<int>((x_marks >> cells[c] & 1) + 2 * (o_marks >> cells[c] & 1));
+        return i;
+    }
+
+    /** @brief The solved position; x_to_move says whose turn it is. */
+    const SolvedPosition& lookup(uint64_t x_marks, uint64_t o_marks, bool x_to_move) const {
+        return solved[x_to_move * SIZE + index(x_marks, o_marks)];
+    }
+
+    /**
+     * @brief The perfect move for `symbol` as a Move on a board `columns`
+     * wide.
+     * @return false if the game is already over.
+     */
+    bool best_move(uint64_t x_marks, uint64_t o_marks, char symbol, int columns, Move<char>& move) const {
+        const SolvedPosition& entry = lookup(x_marks, o_marks, symbol == 'X');
+        if (entry.best < 0) return false;
+        const int bit = cells[entry.best];
+        move = Move<char>(bit / columns, bit % columns, symbol);
+        return true;
+    }
+};
+
+/**
+ * @class PerfectPlayStrategy
+ * @brief Plays the move Board::perfect_move() looks up, so the player
+ * never loses a position it can hold.
+ *
+ * Only for boards that override perfect_move(); on any other board it
+ * has no move to offer.
+ */
+template <typename T>
+class PerfectPlayStrategy : public MoveStrategy<T> {
+public:
+    Move<T> choose_move(Board<T>& board, T symbol) override {
+        Move<T> move;
+        board.perfect_move(symbol, move);
+        return move;
+    }
+};
+
+#endif // NINE_CELL_TABLE_H
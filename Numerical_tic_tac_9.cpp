@@ -5,18 +5,36 @@
 #include <ctime>
 using namespace std;
 Numerical_Board::Numerical_Board() : Board<int>(3, 3) {
-    for (auto& row : board) {
-        for (auto& cell : row) {
-            cell = blank_value;
-        }
-    }
+    board.fill(blank_value);
+    zobrist = ZobristKeys(rows, columns, 10);
 
     Player_Odd  = {1, 3, 5, 7, 9};
     Player_Even = {2, 4, 6, 8};
 }
 
+void Numerical_Board::reset() {
+    board.fill(blank_value);
+    used_numbers = 0;
+    history.clear();
+    n_moves = 0;
+    hash = 0;
+}
+
+void Numerical_Board::generate_moves(int symbol, MoveList<int>& moves) {
+    const set<int>& numbers = (symbol == 1) ? Player_Odd : Player_Even;
+
+    moves.clear();
+    for (int num : numbers) {
+        if (is_used(num)) continue;
+        for (int i = 0; i < rows; ++i)
+            for (int j = 0; j < columns; ++j)
+                if (board[i][j] == blank_value)
+                    moves.add(Move<int>(i, j, num));
+    }
+}
+
 bool Numerical_Board::is_valid_number(int number, Player<int>* player) {
-    if (used_numbers.count(number) > 0) {
+    if (number < 1 || number > 9 || is_used(number)) {
         return false;
     }
 
@@ -35,13 +53,13 @@ set<int> Numerical_Board::get_available_numbers(Player<int>* player) {
 
     if (player_id == 1) {
         for (int num : Player_Odd) {
-            if (used_numbers.count(num) == 0) {
+            if (!is_used(num)) {
                 available.insert(num);
             }
         }
     } else {
         for (int num : Player_Even) {
-            if (used_numbers.count(num) == 0) {
+            if (!is_used(num)) {
                 available.insert(num);
             }
         }
@@ -63,20 +81,28 @@ bool Numerical_Board::update_board(Move<int>* move) {
         return false;
     }
 
-    if (num == 0) {
-        n_moves--;
-        board[x][y] = blank_value;
-        return true;
-    }
-
-    if (used_numbers.count(num) > 0) {
+    if (num < 1 || num > 9 || is_used(num)) {
         return false;
     }
 
     board[x][y] = num;
-    used_numbers.insert(num);
+    used_numbers |= 1u << num;
+    hash ^= zobrist.cell(x, y, number_piece(num)) ^ zobrist.side();
     n_moves++;
+    history.push_back({ x, y });
+
+    return true;
+}
 
+bool Numerical_Board::undo_move() {
+    if (history.empty()) return false;
+
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    used_numbers &= ~(1u << board[cell.first][cell.second]);
+    hash ^= zobrist.cell(cell.first, cell.second, number_piece(board[cell.first][cell.second])) ^ zobrist.side();
+    board[cell.first][cell.second] = blank_value;
+    n_moves--;
     return true;
 }
 
@@ -112,6 +138,28 @@ bool Numerical_Board::is_win(Player<int>* player) {
     return false;
 }
 
+bool Numerical_Board::line_sums_to_15(int r, int c, int dr, int dc) const {
+    int sum = 0;
+    for (int k = 0; k < 3; k++) {
+        int value = board[r + k * dr][c + k * dc];
+        if (value == blank_value) return false;
+        sum += value;
+    }
+    return sum == 15;
+}
+
+Outcome Numerical_Board::evaluate_outcome(const Move<int>& last_move) {
+    int x = last_move.get_x();
+    int y = last_move.get_y();
+
+    if (line_sums_to_15(x, 0, 0, 1) || line_sums_to_15(0, y, 1, 0) ||
+        (x == y && line_sums_to_15(0, 0, 1, 1)) ||
+        (x + y == 2 && line_sums_to_15(0, 2, 1, -1)))
+        return Outcome::WIN;
+
+    return n_moves == 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 bool Numerical_Board::is_draw(Player<int>* player) {
     return (n_moves == 9 && !is_win(player));
 }
@@ -132,7 +180,7 @@ Numerical_UI::Numerical_UI()
 
 Player<int>** Numerical_UI::setup_players() {
     Player<int>** players = new Player<int>*[2];
-    vector<string> type_options = {"Human", "Computer"};
+    vector<string> type_options = {"Human", "Computer", "Search AI"};
 
     string name1 = get_player_name("Player 1 (Odd numbers)");
     PlayerType type1 = get_player_type_choice("Player 1", type_options);
@@ -153,58 +201,36 @@ Player<int>* Numerical_UI::create_player(string& name, int symbol, PlayerType ty
     return new Player<int>(name, symbol, type);
 }
 
-Move<int>* Numerical_UI::get_move(Player<int>* player) {
+Move<int> Numerical_UI::get_move(Player<int>* player) {
     Numerical_Board* board = dynamic_cast<Numerical_Board*>(player->get_board_ptr());
 
     if (!board) {
         cerr << "Error: Invalid board type!\n";
-        return nullptr;
+        return Move<int>();
     }
 
     int x, y, number;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        set<int> available = board->get_available_numbers(player);
-
-        cout << "\n" << player->get_name() << "'s turn\n";
-        cout << "Available numbers: ";
-        for (int num : available) {
-            cout << num << " ";
-        }
-        cout << endl;
-
-        do {
-            cout << "Enter the number you want to place: ";
-            cin >> number;
-
-            if (available.count(number) == 0) {
-                cout << "Invalid number! Choose from available numbers.\n";
-            }
-        } while (available.count(number) == 0);
-
-        cout << "Enter position (row and column, 0-2): ";
-        cin >> x >> y;
+    set<int> available = board->get_available_numbers(player);
 
+    cout << "\n" << player->get_name() << "'s turn\n";
+    cout << "Available numbers: ";
+    for (int num : available) {
+        cout << num << " ";
     }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        set<int> available = board->get_available_numbers(player);
+    cout << endl;
 
-        if (available.empty()) {
-            return nullptr;
-        }
-
-        auto it = available.begin();
-        advance(it, rand() % available.size());
-        number = *it;
+    do {
+        cout << "Enter the number you want to place: ";
+        cin >> number;
 
-        do {
-            x = rand() % board->get_rows();
-            y = rand() % board->get_columns();
-        } while (board->get_board_matrix()[x][y] != 0);
+        if (available.count(number) == 0) {
+            cout << "Invalid number! Choose from available numbers.\n";
+        }
+    } while (available.count(number) == 0);
 
-        cout << "\nComputer " << player->get_name() << " plays: "
-             << number << " at position (" << x << ", " << y << ")\n";
-    }
+    cout << "Enter position (row and column, 0-2): ";
+    cin >> x >> y;
 
-    return new Move<int>(x, y, number);
+    return Move<int>(x, y, number);
 }
\ No newline at end of file
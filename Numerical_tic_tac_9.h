@@ -43,12 +43,34 @@
   *
   * @see Board
   */
-class Numerical_Board : public Board<int> {
+class Numerical_Board final : public Board<int> {
 private:
-    set<int> used_numbers;  ///< Tracks all numbers already placed on board
+    unsigned used_numbers = 0; ///< Bit n is set while number n is on the board
     set<int> Player_Odd;    ///< Available odd numbers for Player 1 {1,3,5,7,9}
     set<int> Player_Even;   ///< Available even numbers for Player 2 {2,4,6,8}
     int blank_value = 0;    ///< Value representing empty cells
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
+
+    /**
+     * @brief Checks if one line is full and sums to 15.
+     *
+     * @param r Row of the line's first cell
+     * @param c Column of the line's first cell
+     * @param dr Row step between cells
+     * @param dc Column step between cells
+     * @return true if all 3 cells are filled and add up to 15
+     */
+    bool line_sums_to_15(int r, int c, int dr, int dc) const;
+
+    /**
+     * @brief Hash key index of a number: 1..9 are 0..8, anything else 9.
+     */
+    static int number_piece(int num) {
+        return (num >= 1 && num <= 9) ? num - 1 : 9;
+    }
+
+    /** @brief Whether number `num` (1..9) is already on the board. */
+    bool is_used(int num) const { return (used_numbers >> num) & 1u; }
 
 public:
     /**
@@ -58,7 +80,7 @@ public:
      * - Empty 33 grid (all cells = 0)
      * - Player_Odd set with {1, 3, 5, 7, 9}
      * - Player_Even set with {2, 4, 6, 8}
-     * - Empty used_numbers set
+     * - No used numbers
      */
     Numerical_Board();
 
@@ -67,7 +89,7 @@ public:
      *
      * Validates:
      * - Position is in bounds and empty
-     * - Number hasn't been used before
+     * - Number is 1..9 and hasn't been used before
      * - Number belongs to current player's set
      *
      * Special case: symbol=0 allows undo of a move
@@ -121,6 +143,43 @@ public:
      */
     bool game_is_over(Player<int>* player) override;
 
+    /**
+     * @brief Checks only the lines through the cell just filled.
+     *
+     * @param last_move The move just applied
+     * @return WIN if a line through it now sums to 15, DRAW if the board
+     *         is full, ONGOING otherwise
+     */
+    Outcome evaluate_outcome(const Move<int>& last_move) override;
+
+    /**
+     * @brief Resets the board for a new game.
+     *
+     * Clears all cells and forgets which numbers have been used.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<int>* clone() const override { return new Numerical_Board(*this); }
+
+    /**
+     * @brief Lists every unused number of the player's parity on every empty cell.
+     * @param symbol Player symbol: 1 plays the odd numbers, anything else the even ones.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(int symbol, MoveList<int>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     *
+     * Clears the cell and makes its number available again.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
+    /** @brief Player 1 (odd numbers) plays against player 2 (even numbers). */
+    int other_symbol(int symbol) const override { return symbol == 1 ? 2 : 1; }
+
     /**
      * @brief Validates if a number can be used by a player.
      *
@@ -188,22 +247,17 @@ public:
     Player<int>* create_player(string& name, int symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a number placement move from player.
+     * @brief Gets a number placement move from a human player.
      *
-     * For human players:
      * - Displays available numbers
      * - Prompts for number selection
      * - Validates number is available
      * - Prompts for position (row, col)
      *
-     * For computer players:
-     * - Randomly selects from available numbers
-     * - Randomly selects empty cell
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move<int> with position and number
+     * @return Move<int> with position and number
      */
-    Move<int>* get_move(Player<int>* player) override;
+    Move<int> get_move(Player<int>* player) override;
 
     /**
      * @brief Sets up both players with correct symbols.
@@ -1,22 +1,38 @@
 #include "Obstacles_Tic_Tac_Toe.h"
+#include "WinLines.h"
+
+// Every four-in-a-row of the 6x6 grid, as masks over marks_of(); obstacles are
+// in neither player's marks, so they block lines without being listed
+static constexpr WinLines<6, 6, 4> obstacle_lines;
 
 Obstacles_Tic_Tac_Toe_Board::Obstacles_Tic_Tac_Toe_Board()
-    : Board<char>(ROWS, COLS)
+    : XOBoardBase(ROWS, COLS)
 {
-
-    for (int r = 0; r < rows; ++r)
-        for (int c = 0; c < columns; ++c)
-            board[r][c] = '.';
-
-    srand(static_cast<unsigned int>(time(nullptr)));
-	
+    // pieces: 0 = X, 1 = O, 2 = obstacle
+    zobrist = ZobristKeys(rows, columns, 3);
+    board.fill('.');
 }
 
 void Obstacles_Tic_Tac_Toe_Board::clear_board() {
-    for (int r = 0; r < rows; ++r)
-        for (int c = 0; c < columns; ++c)
-            board[r][c] = '.';
+    board.fill('.');
     n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    empty_cells = rows * columns;
+}
+
+void Obstacles_Tic_Tac_Toe_Board::reset() {
+    clear_board();
+    moves_this_round = 0;
+    history.clear();
+}
+
+void Obstacles_Tic_Tac_Toe_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == '.')
+                moves.add(Move<char>(i, j, symbol));
 }
 
 vector<pair<int, int>> Obstacles_Tic_Tac_Toe_Board::get_empty_cells() const {
@@ -28,20 +44,22 @@ vector<pair<int, int>> Obstacles_Tic_Tac_Toe_Board::get_empty_cells() const {
     return empties;
 }
 
-void Obstacles_Tic_Tac_Toe_Board::add_random_obstacles(int n) {
-    auto empties = get_empty_cells();
-    if (empties.empty()) return;
-
-    static std::mt19937 rng(static_cast<unsigned int>(std::random_device{}()));
-    std::shuffle(empties.begin(), empties.end(), rng);
+bool Obstacles_Tic_Tac_Toe_Board::add_random_obstacle(int& x, int& y) {
+    x = y = -1;
+    if (empty_cells == 0) return false;
 
-    int placed = 0;
-    for (auto& p : empties) {
-        if (placed >= n) break;
-        int r = p.first, c = p.second;
-        board[r][c] = '#';
-        ++placed;
-    }
+    int skip = rng.uniform(empty_cells);
+    for (int r = 0; r < rows; ++r)
+        for (int c = 0; c < columns; ++c)
+            if (board[r][c] == '.' && skip-- == 0) {
+                board[r][c] = '#';
+                hash ^= zobrist.cell(r, c, 2);
+                --empty_cells;
+                x = r;
+                y = c;
+                return true;
+            }
+    return false;
 }
 
 bool Obstacles_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
@@ -52,78 +70,65 @@ bool Obstacles_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
 
     if (r < 0 || r >= rows || c < 0 || c >= columns) return false;
     if (board[r][c] != '.') return false;
+    UndoEntry entry = { r, c, -1, -1, moves_this_round, rng };
     board[r][c] = sym;
+    hash_xo_move(r, c, sym);
     ++n_moves;
+    --empty_cells;
 	++moves_this_round;
 
     if (moves_this_round == 2) {
-		add_random_obstacles(1);
+		if (random_events) add_random_obstacle(entry.obstacle_x, entry.obstacle_y);
 		moves_this_round = 0;
     }
+    history.push_back(entry);
     return true;
 }
 
-bool Obstacles_Tic_Tac_Toe_Board::four_in_a_row_from(int r, int c, char sym) const {
-    if (board[r][c] != sym) return false;
-    const int dirs[4][2] = { {0,1}, {1,0}, {1,1}, {1,-1} };
-    for (int d = 0; d < 4; ++d) {
-        int dr = dirs[d][0], dc = dirs[d][1];
-        int cnt = 1;
-        int rr = r + dr, cc = c + dc;
-        while (rr >= 0 && rr < rows && cc >= 0 && cc < columns && board[rr][cc] == sym) {
-            ++cnt; rr += dr; cc += dc;
-        }
-        rr = r - dr; cc = c - dc;
-        while (rr >= 0 && rr < rows && cc >= 0 && cc < columns && board[rr][cc] == sym) {
-            ++cnt; rr -= dr; cc -= dc;
-        }
-        if (cnt >= 4) return true;
+bool Obstacles_Tic_Tac_Toe_Board::undo_move() {
+    if (history.empty()) return false;
+
+    UndoEntry& entry = history.back();
+    if (entry.obstacle_x >= 0) {
+        hash ^= zobrist.cell(entry.obstacle_x, entry.obstacle_y, 2);
+        board[entry.obstacle_x][entry.obstacle_y] = '.';
+        ++empty_cells;
     }
-    return false;
+    hash_xo_move(entry.x, entry.y, board[entry.x][entry.y]);
+    board[entry.x][entry.y] = '.';
+    --n_moves;
+    ++empty_cells;
+    moves_this_round = entry.moves_this_round;
+    rng = entry.rng;
+    history.pop_back();
+    return true;
+}
+
+bool Obstacles_Tic_Tac_Toe_Board::set_random_events(bool enabled) {
+    bool previous = random_events;
+    random_events = enabled;
+    return previous;
 }
 
 bool Obstacles_Tic_Tac_Toe_Board::board_full() const {
-    for (int r = 0; r < rows; ++r)
-        for (int c = 0; c < columns; ++c)
-            if (board[r][c] == '.') return false;
-    return true;
+    return empty_cells == 0;
 }
 
 bool Obstacles_Tic_Tac_Toe_Board::is_win(Player<char>* player) {
     if (!player) return false;
-    char sym = player->get_symbol();
-    for (int r = 0; r < rows; ++r)
-        for (int c = 0; c < columns; ++c) {
-            if (board[r][c] == sym && four_in_a_row_from(r, c, sym))
-                return true;
-        }
-    return false;
+    return obstacle_lines.any(marks_of(player->get_symbol()));
 }
 
 bool Obstacles_Tic_Tac_Toe_Board::is_lose(Player<char>* player) {
     if (!player) return false;
-
-    char sym = player->get_symbol();
-    char other = (sym == 'X') ? 'O' : 'X';
-    for (int r = 0; r < rows; ++r)
-        for (int c = 0; c < columns; ++c) {
-            if (board[r][c] == other && four_in_a_row_from(r, c, other))
-                return true;
-        }
-    return false;
+    return obstacle_lines.any(marks_of(player->get_symbol() == 'X' ? 'O' : 'X'));
 }
 
 bool Obstacles_Tic_Tac_Toe_Board::is_draw(Player<char>* player) {
 
     if (board_full()) {
 
-        for (int r = 0; r < rows; ++r)
-            for (int c = 0; c < columns; ++c) {
-                char ch = board[r][c];
-                if (ch == 'X' || ch == 'O')
-                    if (four_in_a_row_from(r, c, ch)) return false;
-            }
-        return true;
+        return !obstacle_lines.any(marks[0]) && !obstacle_lines.any(marks[1]);
     }
     return false;
 }
@@ -132,22 +137,22 @@ bool Obstacles_Tic_Tac_Toe_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_lose(player) || is_draw(player);
 }
 
+Outcome Obstacles_Tic_Tac_Toe_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (obstacle_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return board_full() ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 
-Move<char>* Obstacles_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
+Move<char> Obstacles_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
     int x, y;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\nPlease enter your move x and y (0 to 5): ";
-        cin >> x >> y;
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        x = rand() % player->get_board_ptr()->get_rows();
-        y = rand() % player->get_board_ptr()->get_columns();
-    }
-    return new Move<char>(x, y, player->get_symbol());
+    cout << "\nPlease enter your move x and y (0 to 5): ";
+    cin >> x >> y;
+    return Move<char>(x, y, player->get_symbol());
 }
 
 Player<char>* Obstacles_Tic_Tac_Toe_UI::create_player(string& name, char symbol, PlayerType type) {
-    Player<char>* p = new Player<char>(name, symbol, type);
-    return p;
+    return new Player<char>(name, symbol, type);
 }
\ No newline at end of file
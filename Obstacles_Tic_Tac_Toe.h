@@ -16,12 +16,11 @@
 
 #include <iostream>
 #include <vector>
-#include <ctime>
 #include <cstdlib>
 #include <algorithm>
-#include <random>
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 
 using namespace std;
 
@@ -46,7 +45,7 @@ using namespace std;
  *
  * @see Board
  */
-class Obstacles_Tic_Tac_Toe_Board : public Board<char> {
+class Obstacles_Tic_Tac_Toe_Board final : public XOBoardBase {
 public:
     static const int ROWS = 6; ///< Board height (6 rows)
     static const int COLS = 6; ///< Board width (6 columns)
@@ -54,8 +53,8 @@ public:
     /**
      * @brief Constructs a 66 board.
      *
-     * Initializes all cells as empty ('.') and seeds random
-     * number generator for obstacle placement.
+     * Initializes all cells as empty ('.'). Obstacle placement draws from
+     * the board's own random engine (see Board::seed).
      */
     Obstacles_Tic_Tac_Toe_Board();
 
@@ -120,14 +119,61 @@ public:
     virtual bool game_is_over(Player<char>* player) override;
 
     /**
-     * @brief Adds random obstacles to empty cells.
+     * @brief Checks only the four lines through the cell just filled.
      *
-     * Randomly selects n empty cells and places obstacle markers ('#').
-     * Uses modern C++ random shuffling for fair distribution.
+     * Obstacles never complete a line and the opponent's pieces did not
+     * move, so a new 4-in-a-row can only pass through the mover's cell.
      *
-     * @param n Number of obstacles to add (default: 2)
+     * @param last_move The move just applied
+     * @return WIN for 4 in a row, DRAW if no empty cell is left, else ONGOING
      */
-    void add_random_obstacles(int n = 2);
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets board and obstacle round counter for a new game.
+     */
+    virtual void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new Obstacles_Tic_Tac_Toe_Board(*this); }
+
+    /**
+     * @brief Lists every empty cell; marks and obstacles are
+     * never listed.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     *
+     * Also removes any obstacle the move triggered and rewinds the board's
+     * random engine, so replaying the move places the same obstacle.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
+    /**
+     * @brief Turn obstacle drops on or off. While they are off, a round
+     * still ends every two moves but places nothing, which is how search
+     * engines play the game (see ChanceFreeSearch).
+     * @return Whether drops were on before the call.
+     */
+    bool set_random_events(bool enabled) override;
+
+    /**
+     * @brief Adds an obstacle marker ('#') to a random empty cell.
+     *
+     * The cell is drawn uniformly with the board's random engine: an index
+     * over the empty cells, found by scanning the grid, so nothing is
+     * allocated.
+     *
+     * @param x Receives the obstacle's row, or -1 if the board is full
+     * @param y Receives the obstacle's column, or -1 if the board is full
+     * @return true if an obstacle was placed
+     */
+    bool add_random_obstacle(int& x, int& y);
 
     /**
      * @brief Resets board to empty state.
@@ -149,25 +195,19 @@ public:
 
 private:
     /**
-     * @brief Checks for 4-in-a-row starting from specific position.
-     *
-     * Searches in all 4 directions (horizontal, vertical, both diagonals)
-     * counting consecutive matching symbols in both forward and backward
-     * directions from the starting cell.
+     * @brief Checks if board is completely filled.
      *
-     * @param r Starting row
-     * @param c Starting column
-     * @param sym Symbol to check for
-     * @return true if 4+ consecutive symbols found, false otherwise
+     * @return true if no empty cells remain, false otherwise
      */
-    bool four_in_a_row_from(int r, int c, char sym) const;
+    bool board_full() const;
 
     /**
-     * @brief Checks if board is completely filled.
+     * @brief Number of '.' cells left.
      *
-     * @return true if no empty cells remain, false otherwise
+     * Kept up to date by every method that places or clears a mark or
+     * obstacle, so board_full() does not have to scan the grid.
      */
-    bool board_full() const;
+    int empty_cells = ROWS * COLS;
 
     /**
      * @brief Tracks moves in current round (resets every 2 moves).
@@ -176,6 +216,17 @@ private:
      * an obstacle is added and counter resets to 0.
      */
     int moves_this_round = 0;
+
+    bool random_events = true; ///< Whether a finished round drops an obstacle
+
+    /** @brief What an applied move changed, for undo_move(). */
+    struct UndoEntry {
+        int x, y;                     ///< Cell the mark was placed in
+        int obstacle_x, obstacle_y;   ///< Obstacle the move dropped, or -1
+        int moves_this_round;         ///< Round counter before the move
+        RandomEngine rng;             ///< Board engine before the move
+    };
+    vector<UndoEntry> history; ///< Applied moves, oldest first
 };
 
 /**
@@ -192,7 +243,9 @@ public:
     /**
      * @brief Constructs UI with game title.
      */
-    Obstacles_Tic_Tac_Toe_UI() : UI<char>("Obstacles Tic-Tac-Toe UI", 2) {}
+    Obstacles_Tic_Tac_Toe_UI() : UI<char>("Obstacles Tic-Tac-Toe UI", 2) {
+        type_options.push_back("MCTS AI");
+    }
 
     /**
      * @brief Virtual destructor.
@@ -200,25 +253,22 @@ public:
     virtual ~Obstacles_Tic_Tac_Toe_UI() override = default;
 
     /**
-     * @brief Gets a move from player.
+     * @brief Gets a move from a human player.
      *
-     * For human players:
      * - Prompts for x and y coordinates (0 to 5)
      *
-     * For computer players:
-     * - Randomly selects position in 66 grid
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move object with position and symbol
+     * @return Move object with position and symbol
      */
-    virtual Move<char>* get_move(Player<char>* player) override;
+    virtual Move<char> get_move(Player<char>* player) override;
 
     /**
      * @brief Creates a player of specified type.
      *
      * @param name Player name
      * @param symbol Player symbol ('X' or 'O')
-     * @param type Player type (HUMAN or COMPUTER)
+     * @param type Player type. The registry gives AI players an
+     * MCTSEngine (see mcts_engine() in Main_Menu.cpp)
      * @return Pointer to new Player object
      */
     virtual Player<char>* create_player(string& name, char symbol, PlayerType type) override;
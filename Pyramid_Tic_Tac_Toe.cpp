@@ -4,16 +4,31 @@
 #include <iomanip>
 #include <cctype>  // for toupper()
 #include "Pyramid_Tic_Tac_Toe.h"
+#include "WinLines.h"
+#include "NineCellTable.h"
 
 using namespace std;
 
+// The nine playable cells, and the seven winning combinations inside them
+static constexpr uint64_t pyramid_cells = cell_mask(5, { {0, 2}, {1, 1}, {1, 2}, {1, 3},
+    {2, 0}, {2, 1}, {2, 2}, {2, 3}, {2, 4} });
+static constexpr WinLines<3, 5, 3, pyramid_cells> pyramid_lines;
+
 //--------------------------------------- Pyramid_Tic_Tac_Toe_Board Implementation
 
-Pyramid_Tic_Tac_Toe_Board::Pyramid_Tic_Tac_Toe_Board() : Board(3, 5) {
+Pyramid_Tic_Tac_Toe_Board::Pyramid_Tic_Tac_Toe_Board() : XOBoardBase(3, 5) {
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void Pyramid_Tic_Tac_Toe_Board::reset() {
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    board.fill(blank_symbol);
+    history.clear();
 
     // Mark the unused cells with 
     for (int i = 0; i < 2; i++) {
@@ -25,6 +40,14 @@ Pyramid_Tic_Tac_Toe_Board::Pyramid_Tic_Tac_Toe_Board() : Board(3, 5) {
     }
 }
 
+void Pyramid_Tic_Tac_Toe_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
+}
+
 bool Pyramid_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
     int x = move->get_x();
     int y = move->get_y();
@@ -32,44 +55,30 @@ bool Pyramid_Tic_Tac_Toe_Board::update_board(Move<char>* move) {
 
     // Validate move and apply if valid
     if (!(x < 0 || x >= rows || y < 0 || y >= columns) &&
-        (board[x][y] == blank_symbol || mark == 0 )) {
+        (board[x][y] == blank_symbol)) {
 
-        if (mark == 0) { // Undo move
-            n_moves--;
-            board[x][y] = blank_symbol;
-        }
-        else {         // Apply move
-            n_moves++;
-            board[x][y] = toupper(mark);
-        }
+        n_moves++;
+        board[x][y] = toupper(mark);
+        hash_xo_move(x, y, board[x][y]);
+        history.push_back({ x, y });
         return true;
     }
     return false;
 }
 
+bool Pyramid_Tic_Tac_Toe_Board::undo_move() {
+    if (history.empty()) return false;
+
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
+
 bool Pyramid_Tic_Tac_Toe_Board::is_win(Player<char>* player) {
-    const char sym = player->get_symbol();
-
-    auto all_equal = [&](char a, char b, char c) {
-        return a == b && b == c && a != blank_symbol;
-        };
-
-	//cheak the seven winning combinations
-    if (all_equal(board[0][2], board[1][2], board[2][2]) && board[0][2]==sym) //vertical middle
-		return true;
-	if (all_equal(board[2][0], board[2][1], board[2][2]) && board[2][0] == sym) //bottom left horizontal
-		return true;
-	if (all_equal(board[2][2], board[2][3], board[2][4]) && board[2][2] == sym) //bottom right horizontal
-		return true;
-	if (all_equal(board[0][2], board[1][1], board[2][0]) && board[0][2] == sym) //left diagonal
-		return true;
-	if (all_equal(board[0][2], board[1][3], board[2][4]) && board[0][2] == sym) //right diagonal
-		return true;
-	if (all_equal(board[1][1], board[1][2], board[1][3]) && board[1][1] == sym) //middle left diagonal
-		return true;
-	if (all_equal(board[2][1], board[2][2], board[2][3]) && board[2][1] == sym) //middle right diagonal
-		return true;
-    return false;
+    return pyramid_lines.any(marks_of(player->get_symbol()));
 }
 
 bool Pyramid_Tic_Tac_Toe_Board::is_draw(Player<char>* player) {
@@ -80,6 +89,18 @@ bool Pyramid_Tic_Tac_Toe_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome Pyramid_Tic_Tac_Toe_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (pyramid_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return n_moves == 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
+bool Pyramid_Tic_Tac_Toe_Board::perfect_move(char symbol, Move<char>& move) const {
+    static const NineCellTable table(pyramid_lines.all, pyramid_lines.COUNT, pyramid_cells, Outcome::WIN, Outcome::DRAW);
+    return table.best_move(marks[0], marks[1], symbol, columns, move);
+}
+
 //--------------------------------------- Pyramid_Tic_Tac_Toe_UI Implementation
 
 Pyramid_Tic_Tac_Toe_UI::Pyramid_Tic_Tac_Toe_UI() : UI<char>("Weclome to Pyramid_Tic_Tac_Toe Game ya ghaly", 3) {}
@@ -92,16 +113,10 @@ Player<char>* Pyramid_Tic_Tac_Toe_UI::create_player(string& name, char symbol, P
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Pyramid_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
+Move<char> Pyramid_Tic_Tac_Toe_UI::get_move(Player<char>* player) {
     int x, y;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\nPlease enter your move coordinates : ";
-        cin >> x >> y;
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        x = rand() % player->get_board_ptr()->get_rows();
-        y = rand() % player->get_board_ptr()->get_columns();
-    }
-    return new Move<char>(x, y, player->get_symbol());
+    cout << "\nPlease enter your move coordinates : ";
+    cin >> x >> y;
+    return Move<char>(x, y, player->get_symbol());
 }
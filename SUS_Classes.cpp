@@ -5,6 +5,25 @@
 using namespace std;
 
 SUS_Board::SUS_Board() : Board<char>(3, 3), s_score(0), u_score(0) {
+    zobrist = ZobristKeys(rows, columns, 3, 2 * (MAX_SCORE + 1));
+    reset();
+}
+
+void SUS_Board::reset() {
+    board.fill(0);
+    n_moves = 0;
+    s_score = 0;
+    u_score = 0;
+    hash = scores_key();
+    history.clear();
+}
+
+void SUS_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == 0)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool SUS_Board::update_board(Move<char>* move) {
@@ -59,16 +78,38 @@ bool SUS_Board::update_board(Move<char>* move) {
             points++;
     }
 
+    hash ^= scores_key();
     if (symbol == 'S') {
         s_score += points;
     }
     else {
         u_score += points;
     }
+    hash ^= scores_key() ^ zobrist.cell(r, c, letter_piece(symbol)) ^ zobrist.side();
+    history.push_back({ r, c, points });
 
     return true;
 }
 
+bool SUS_Board::undo_move() {
+    if (history.empty()) return false;
+
+    UndoEntry entry = history.back();
+    history.pop_back();
+    char letter = board[entry.x][entry.y];
+    hash ^= scores_key();
+    if (letter == 'S') {
+        s_score -= entry.points;
+    }
+    else {
+        u_score -= entry.points;
+    }
+    hash ^= scores_key() ^ zobrist.cell(entry.x, entry.y, letter_piece(letter)) ^ zobrist.side();
+    board[entry.x][entry.y] = 0;
+    n_moves--;
+    return true;
+}
+
 bool SUS_Board::game_is_over(Player<char>* player) {
     return n_moves >= 9;
 }
@@ -96,13 +137,23 @@ bool SUS_Board::is_draw(Player<char>* player) {
     return s_score == u_score;
 }
 
+Outcome SUS_Board::evaluate_outcome(const Move<char>& last_move) {
+    if (n_moves < 9) return Outcome::ONGOING;
+    if (s_score == u_score) return Outcome::DRAW;
+
+    char sym = last_move.get_symbol();
+    if (sym == 'S') return s_score > u_score ? Outcome::WIN : Outcome::LOSS;
+    if (sym == 'U') return u_score > s_score ? Outcome::WIN : Outcome::LOSS;
+    return Outcome::ONGOING;
+}
+
 
 SUS_UI::SUS_UI() : UI<char>("Welcome to the SUS Game!", 3) {
 }
 
 Player<char>** SUS_UI::setup_players() {
     Player<char>** players = new Player<char>*[2];
-    vector<string> type_options = { "Human", "Computer" };
+    vector<string> type_options = { "Human", "Computer", "Search AI" };
 
     cout << "\n-- Setup Player 1 (Plays 'S') --" << endl;
     string nameS = get_player_name("Player 1");
@@ -121,7 +172,7 @@ Player<char>* SUS_UI::create_player(string& name, char symbol, PlayerType type)
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* SUS_UI::get_move(Player<char>* player) {
+Move<char> SUS_UI::get_move(Player<char>* player) {
     SUS_Board* board = dynamic_cast<SUS_Board*>(player->get_board_ptr());
     if (board) {
         cout << "\nCurrent Score -> S: " << board->get_s_score()
@@ -129,23 +180,14 @@ Move<char>* SUS_UI::get_move(Player<char>* player) {
     }
 
     int x, y;
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << player->get_name() << " (" << player->get_symbol() << "), enter row and column (0-2): ";
+    cout << player->get_name() << " (" << player->get_symbol() << "), enter row and column (0-2): ";
+    cin >> x >> y;
+    while (cin.fail()) {
+        cin.clear();
+        cin.ignore(1000, '\n');
+        cout << "Invalid input. Enter numbers: ";
         cin >> x >> y;
-        while (cin.fail()) {
-            cin.clear();
-            cin.ignore(1000, '\n');
-            cout << "Invalid input. Enter numbers: ";
-            cin >> x >> y;
-        }
-    }
-    else {
-        do {
-            x = rand() % 3;
-            y = rand() % 3;
-        } while (player->get_board_ptr()->get_board_matrix()[x][y] != 0);
-        cout << "Computer " << player->get_name() << " places at " << x << " " << y << endl;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
\ No newline at end of file
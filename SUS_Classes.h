@@ -42,11 +42,37 @@
   *
   * @see Board
   */
-class SUS_Board : public Board<char> {
+class SUS_Board final : public Board<char> {
 private:
     int s_score; ///< Score for player placing 'S' letters
     int u_score; ///< Score for player placing 'U' letters
 
+    /** @brief What an applied move changed, for undo_move(). */
+    struct UndoEntry {
+        int x, y;   ///< Cell the letter was placed in
+        int points; ///< Points the placement scored
+    };
+    vector<UndoEntry> history; ///< Applied moves, oldest first
+
+    static const int MAX_SCORE = 8; ///< A 3x3 board has 8 lines, so at most 8 patterns
+
+    /**
+     * @brief Hash key index of a letter: 'S' is 0, 'U' is 1, anything else 2.
+     */
+    static int letter_piece(char letter) {
+        return letter == 'S' ? 0 : (letter == 'U' ? 1 : 2);
+    }
+
+    /**
+     * @brief Hash keys of the current scores.
+     *
+     * Who scored a pattern depends on the order the letters were placed,
+     * so the scores are part of the position, not just the grid.
+     */
+    uint64_t scores_key() const {
+        return zobrist.extra(s_score) ^ zobrist.extra(MAX_SCORE + 1 + u_score);
+    }
+
 public:
     /**
      * @brief Constructs a 33 SUS board.
@@ -113,6 +139,51 @@ public:
      */
     bool game_is_over(Player<char>* player) override;
 
+    /**
+     * @brief Compares the running scores once the board is full.
+     *
+     * Scores are updated as letters are placed, so no lines are counted here.
+     *
+     * @param last_move The move just applied
+     * @return ONGOING before move 9, then WIN, LOSS or DRAW for the mover's letter
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board for a new game.
+     *
+     * Clears all cells and sets both scores back to 0.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new SUS_Board(*this); }
+
+    /**
+     * @brief Lists every empty cell as a placement of `symbol`.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     *
+     * Clears the cell and subtracts the points the move scored.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
+    /**
+     * @brief Score lead of `symbol`'s player, which decides the game at the end.
+     */
+    int evaluate_position(char symbol) override {
+        return symbol == 'S' ? s_score - u_score : u_score - s_score;
+    }
+
+    /** @brief 'S' plays against 'U'. */
+    char other_symbol(char symbol) const override { return symbol == 'S' ? 'U' : 'S'; }
+
     /**
      * @brief Gets current score for 'S' player.
      *
@@ -155,23 +226,18 @@ public:
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a move from player with score display.
+     * @brief Gets a move from a human player with score display.
      *
      * Before prompting for move, displays current scores.
      *
-     * For human players:
      * - Shows current S and U scores
      * - Prompts for row and column (0-2)
      * - Validates input
      *
-     * For computer players:
-     * - Randomly selects empty cell
-     * - Displays chosen position
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move object with position and symbol
+     * @return Move object with position and symbol
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 
     /**
      * @brief Sets up both players with correct symbols.
@@ -0,0 +1,136 @@
+/**
+ * @file SelfPlay.h
+ * @brief Headless game loop with every call resolved at compile time.
+ *
+ * This file provides:
+ * - `RandomPolicy`: Plays uniformly random moves, like a "Computer" player.
+ * - `StrategyPolicy`: Plays the moves of a MoveStrategy of known type,
+ *   such as NegamaxEngine<char, B>.
+ * - `self_play`: One game; the counterpart of GameManager::play_headless().
+ * - `self_play_batch`: Many games; the counterpart of GameManager::run_batch().
+ *
+ * GameManager reaches the board, players and strategies through
+ * base-class pointers, so each turn costs several virtual calls. Here the
+ * board and both move sources are template parameters, and board classes
+ * are `final`, so every call in the loop is direct and can be inlined.
+ * GameManager stays the loop for interactive play.
+ *
+ * A policy is any type with
+ * `Move<T> choose_move(B& board, T symbol)` and `void seed(uint64_t)`.
+ * Seeding follows GameManager, so two RandomPolicy players replay the
+ * games run_batch() plays with two "Computer" players whose strategy is
+ * the default RandomStrategy.
+ */
+
+#ifndef SELF_PLAY_H
+#define SELF_PLAY_H
+
+#include <chrono>
+#include <vector>
+#include "BoardGame_Classes.h"
+
+using namespace std;
+
+/**
+ * @brief Plays a uniformly random legal move, from its own random stream.
+ */
+class RandomPolicy {
+    RandomEngine rng;
+
+public:
+    /** @brief Seed as Player::seed() seeds a player's RandomStrategy. */
+    void seed(uint64_t s) { rng.seed(RandomEngine::derive(s, 1)); }
+
+    /** @brief A random move for `symbol`, or an empty Move if it has none. */
+    template <typename B, typename T>
+    Move<T> choose_move(B& board, T symbol) {
+        Move<T> move;
+        board.random_move(symbol, rng, move);
+        return move;
+    }
+};
+
+/**
+ * @brief Plays the moves of a strategy whose concrete type is known.
+ *
+ * @tparam S A MoveStrategy subclass. Its choose_move() is called by
+ * qualified name, so the call is not virtual.
+ */
+template <typename S>
+class StrategyPolicy {
+    S& strategy;
+
+public:
+    /** @brief Play with `s`; it must outlive the policy. */
+    explicit StrategyPolicy(S& s) : strategy(s) {}
+
+    /** @brief Seed as Player::seed() seeds a player's strategy. */
+    void seed(uint64_t s) { strategy.seed(RandomEngine::derive(s, 1)); }
+
+    template <typename B, typename T>
+    Move<T> choose_move(B& board, T symbol) {
+        return strategy.S::choose_move(board, symbol);
+    }
+};
+
+/**
+ * @brief Play one game from the board's current position.
+ *
+ * Same turn order and end-of-game checks as GameManager::play_headless():
+ * `first` moves first with `first_symbol`, a rejected move is asked for
+ * again, and the game ends on the first outcome other than ONGOING.
+ *
+ * @param seed Stored in the result, to replay the game.
+ * @return Winner index (-1 for a draw), accepted move count and wall time.
+ */
+template <typename B, typename First, typename Second, typename T>
+GameResult self_play(B& board, First& first, Second& second, T first_symbol, T second_symbol, uint64_t seed = 0) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    GameResult result = { -1, 0, 0.0, seed };
+
+    for (int i = 0; ; i ^= 1) {
+        Move<T> move = i == 0 ? first.choose_move(board, first_symbol) : second.choose_move(board, second_symbol);
+        while (!board.update_board(&move))
+            move = i == 0 ? first.choose_move(board, first_symbol) : second.choose_move(board, second_symbol);
+        result.moves++;
+
+        Outcome outcome = board.evaluate_outcome(move);
+        if (outcome == Outcome::WIN)
+            result.winner = i;
+        else if (outcome == Outcome::LOSS)
+            result.winner = 1 - i;
+        if (outcome != Outcome::ONGOING) break;
+    }
+
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/**
+ * @brief Play n_games back-to-back with cout silenced.
+ *
+ * Game g is seeded with RandomEngine::derive(seed, g) and split between
+ * the board and the two policies exactly as GameManager::seed() splits it
+ * between the board and two players; the board is reset before every
+ * game.
+ *
+ * @return One GameResult per game.
+ */
+template <typename B, typename First, typename Second, typename T>
+vector<GameResult> self_play_batch(B& board, First& first, Second& second, T first_symbol, T second_symbol,
+                                   int n_games, uint64_t seed = 0) {
+    vector<GameResult> results;
+    results.reserve(n_games);
+    SilentOutput silence;
+    for (int g = 0; g < n_games; ++g) {
+        uint64_t game_seed = RandomEngine::derive(seed, g);
+        board.seed(RandomEngine::derive(game_seed, 0));
+        first.seed(RandomEngine::derive(game_seed, 1));
+        second.seed(RandomEngine::derive(game_seed, 2));
+        board.reset();
+        results.push_back(self_play(board, first, second, first_symbol, second_symbol, game_seed));
+    }
+    return results;
+}
+
+#endif // SELF_PLAY_H
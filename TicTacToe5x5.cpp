@@ -1,10 +1,33 @@
 ﻿#include "TicTacToe5x5.h"
+#include "WinLines.h"
 #include <iostream>
 
+// Every three-in-a-row of the 5x5 grid, as masks over marks_of()
+static constexpr WinLines<5, 5, 3> three_lines;
+
 // --- Board Implementation --- //
 
-TicTacToe5x5::TicTacToe5x5() : Board<char>(5, 5) {
+TicTacToe5x5::TicTacToe5x5() : XOBoardBase(5, 5) {
     n_moves = 0;
+    zobrist = ZobristKeys(rows, columns, 2);
+}
+
+void TicTacToe5x5::reset() {
+    board.fill(0);
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    history.clear();
+    x_threes = 0;
+    o_threes = 0;
+}
+
+void TicTacToe5x5::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == 0)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 
@@ -20,33 +43,39 @@ bool TicTacToe5x5::update_board(Move<char>* move) {
 
     board[x][y] = move->get_symbol();
     n_moves++;
+    hash_xo_move(x, y, board[x][y]);
+    history.push_back({ x, y });
+
+    if (board[x][y] == 'X') x_threes += threes_through(x, y);
+    else if (board[x][y] == 'O') o_threes += threes_through(x, y);
 
     return true;
 }
 
+bool TicTacToe5x5::undo_move() {
+    if (history.empty()) return false;
 
-int TicTacToe5x5::count_three_in_a_row(char symbol) {
-    int count = 0;
-
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < 5; j++) {
-
-            if (j + 2 < 5 && board[i][j] == symbol && board[i][j + 1] == symbol && board[i][j + 2] == symbol)
-                count++;
+    pair<int, int> cell = history.back();
+    history.pop_back();
 
-
-            if (i + 2 < 5 && board[i][j] == symbol && board[i + 1][j] == symbol && board[i + 2][j] == symbol)
-                count++;
+    char mark = board[cell.first][cell.second];
+    if (mark == 'X') x_threes -= threes_through(cell.first, cell.second);
+    else if (mark == 'O') o_threes -= threes_through(cell.first, cell.second);
+    hash_xo_move(cell.first, cell.second, mark);
+    board[cell.first][cell.second] = 0;
+    n_moves--;
+    return true;
+}
 
 
-            if (i + 2 < 5 && j + 2 < 5 && board[i][j] == symbol && board[i + 1][j + 1] == symbol && board[i + 2][j + 2] == symbol)
-                count++;
+int TicTacToe5x5::threes_through(int x, int y) const {
+    return three_lines.count_through(x, y, marks_of(board[x][y]));
+}
 
-            if (i + 2 < 5 && j - 2 >= 0 && board[i][j] == symbol && board[i + 1][j - 1] == symbol && board[i + 2][j - 2] == symbol)
-                count++;
-        }
-    }
-    return count;
+int TicTacToe5x5::count_three_in_a_row(char symbol) {
+    if (symbol == 'X') return x_threes;
+    if (symbol == 'O') return o_threes;
+    return 0;
 }
 
 
@@ -85,58 +114,61 @@ bool TicTacToe5x5::is_draw(Player<char>* player) {
     return count_three_in_a_row(my_symbol) == count_three_in_a_row(opp_symbol);
 }
 
+Outcome TicTacToe5x5::evaluate_outcome(const Move<char>& last_move) {
+    if (n_moves < 24) return Outcome::ONGOING;
 
-// --- UI Implementation --- //
+    char my_symbol = last_move.get_symbol();
+    char opp_symbol = (my_symbol == 'X') ? 'O' : 'X';
 
-TicTacToe5x5_UI::TicTacToe5x5_UI() : UI<char>("Welcome to 5x5 Tic-Tac-Toe Game!", 5) {}
+    int my_score = count_three_in_a_row(my_symbol);
+    int opp_score = count_three_in_a_row(opp_symbol);
 
-Player<char>* TicTacToe5x5_UI::create_player(string& name, char symbol, PlayerType type) {
-    return new Player<char>(name, symbol, type);
+    if (my_score > opp_score) return Outcome::WIN;
+    if (my_score < opp_score) return Outcome::LOSS;
+    return Outcome::DRAW;
 }
 
-Move<char>* TicTacToe5x5_UI::get_move(Player<char>* player) {
-    int x, y;
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << player->get_name() << " (" << player->get_symbol() << ") enter move (row col): ";
-        cin >> x >> y;
-    }
-    else {
-        
-
-        TicTacToe5x5* current_board = (TicTacToe5x5*)player->get_board_ptr();
-        int best_score = -1; 
-        int best_x = -1, best_y = -1; 
-
-        for (int i = 0; i < 5; ++i) {
-            for (int j = 0; j < 5; ++j) {
-                if (current_board->get_board_matrix()[i][j] == 0) {
-
-                    TicTacToe5x5 temp_board = *current_board;
-                    Move<char> temp_move(i, j, player->get_symbol());
-                    temp_board.update_board(&temp_move);
-
-                    int score = temp_board.count_three_in_a_row(player->get_symbol());
-
-                    if (score > best_score) {
-                        best_score = score;
-                        best_x = i;
-                        best_y = j;
-                    }
-                }
-            }
-        }
 
-        if (best_x != -1) {
-            x = best_x;
-            y = best_y;
-        }
-        else {
-            
-            do {
-                x = rand() % 5;
-                y = rand() % 5;
-            } while (current_board->get_board_matrix()[x][y] != 0);
+// --- Computer Strategy --- //
+
+Move<char> TicTacToe5x5_GreedyStrategy::choose_move(Board<char>& board, char symbol) {
+    TicTacToe5x5& grid = static_cast<TicTacToe5x5&>(board);
+    MoveList<char> moves;
+    grid.generate_moves(symbol, moves);
+
+    Move<char> best;
+    int best_score = -1;
+    for (int i = 0; i < moves.size(); ++i) {
+        Move<char> move = moves[i];
+        grid.update_board(&move);
+        int score = grid.count_three_in_a_row(symbol);
+        grid.undo_move();
+
+        if (score > best_score) {
+            best_score = score;
+            best = move;
         }
     }
-    return new Move<char>(x, y, player->get_symbol());
+    return best;
+}
+
+
+// --- UI Implementation --- //
+
+TicTacToe5x5_UI::TicTacToe5x5_UI() : UI<char>("Welcome to 5x5 Tic-Tac-Toe Game!", 5) {
+    type_options.push_back("MCTS AI");
+}
+
+Player<char>* TicTacToe5x5_UI::create_player(string& name, char symbol, PlayerType type) {
+    Player<char>* player = new Player<char>(name, symbol, type);
+    if (type == PlayerType::COMPUTER)
+        player->set_strategy(new TicTacToe5x5_GreedyStrategy());
+    return player;
+}
+
+Move<char> TicTacToe5x5_UI::get_move(Player<char>* player) {
+    int x, y;
+    cout << player->get_name() << " (" << player->get_symbol() << ") enter move (row col): ";
+    cin >> x >> y;
+    return Move<char>(x, y, player->get_symbol());
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 
  /**
   * @class TicTacToe5x5
@@ -43,7 +44,27 @@
   *
   * @see Board
   */
-class TicTacToe5x5 : public Board<char> {
+class TicTacToe5x5 final : public XOBoardBase {
+private:
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
+    int x_threes = 0; ///< Three-in-a-rows currently held by 'X'
+    int o_threes = 0; ///< Three-in-a-rows currently held by 'O'
+
+    /**
+     * @brief Counts the three-in-a-rows of the mark in (x, y) that pass
+     * through that cell.
+     *
+     * A move can only make or break the patterns through its own cell,
+     * so update_board() and undo_move() keep the tallies current with
+     * this instead of rescanning the board. The patterns come from a
+     * WinLines table, so this is a fixed run of mask compares.
+     *
+     * @param x Row of an occupied cell
+     * @param y Column of an occupied cell
+     * @return Number of patterns through (x, y)
+     */
+    int threes_through(int x, int y) const;
+
 public:
     /**
      * @brief Constructs a 5×5 board.
@@ -105,31 +126,91 @@ public:
     bool game_is_over(Player<char>* player) override;
 
     /**
-     * @brief Counts total three-in-a-row patterns for a symbol.
+     * @brief Decides the game from the running tallies.
+     *
+     * Nothing is counted here: the game only ends after 24 moves, and
+     * the three-in-a-row tallies are already up to date.
+     *
+     * @param last_move The move just applied
+     * @return ONGOING before move 24, then WIN, LOSS or DRAW for the mover
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to an empty 5×5 grid.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new TicTacToe5x5(*this); }
+
+    /**
+     * @brief Lists every empty cell as a move for `symbol`.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
+    /**
+     * @brief Lead of `symbol` in three-in-a-row patterns, which decides the
+     * game once the board is full.
+     */
+    int evaluate_position(char symbol) override {
+        return symbol == 'X' ? x_threes - o_threes : o_threes - x_threes;
+    }
+
+    /**
+     * @brief Returns total three-in-a-row patterns for a symbol.
      *
-     * Scans entire board in all 4 directions:
+     * Patterns are counted in all 4 directions:
      * - Horizontal (→)
      * - Vertical (↓)
      * - Diagonal down-right (↘)
      * - Diagonal down-left (↙)
      *
-     * For each starting position, checks if there are 3 consecutive
-     * matching symbols. Overlapping patterns are counted separately.
+     * Overlapping patterns are counted separately. The totals are kept
+     * up to date move by move, so this does not scan the board.
      *
      * Example: "XXXX" contains 2 patterns: X[XXX] and [XXX]X
      *
      * @param symbol The symbol to count ('X' or 'O')
-     * @return Total number of three-in-a-row patterns found
+     * @return Total number of three-in-a-row patterns, 0 for any other symbol
      */
     int count_three_in_a_row(char symbol);
 };
 
+/**
+ * @class TicTacToe5x5_GreedyStrategy
+ * @brief The 5×5 "Computer" player: plays the move that leaves it the
+ * most three-in-a-rows.
+ *
+ * Tries every empty cell with update_board()/undo_move() and keeps the
+ * first one with the highest count. Only for TicTacToe5x5 boards.
+ *
+ * @see MoveStrategy
+ */
+class TicTacToe5x5_GreedyStrategy : public MoveStrategy<char> {
+public:
+    /**
+     * @brief Picks the move with the best three-in-a-row count.
+     *
+     * @return The chosen move, or an empty Move if the board is full
+     */
+    Move<char> choose_move(Board<char>& board, char symbol) override;
+};
+
 /**
  * @class TicTacToe5x5_UI
  * @brief User interface for 5×5 Tic-Tac-Toe.
  *
- * Provides player setup and move input functionality with
- * intelligent AI that tries to maximize its three-in-a-row count.
+ * Provides player setup and move input for human players. Computer
+ * players use TicTacToe5x5_GreedyStrategy.
  *
  * @see UI
  */
@@ -147,30 +228,20 @@ public:
      *
      * @param name Player name
      * @param symbol Player symbol ('X' or 'O')
-     * @param type Player type (HUMAN or COMPUTER)
+     * @param type Player type; COMPUTER players play greedily
+     * (TicTacToe5x5_GreedyStrategy). The registry gives AI players an
+     * MCTSEngine (see mcts_engine() in Main_Menu.cpp)
      * @return Pointer to new Player object
      */
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a move from player.
-     *
-     * For human players:
-     * - Prompts for row and column (0-4)
-     *
-     * For computer players:
-     * - Uses greedy strategy to maximize three-in-a-row count
-     * - Tests each empty position to see which creates most patterns
-     * - Selects position with highest score
-     * - Falls back to random if no good move found
+     * @brief Gets a move from a human player.
      *
-     * AI strategy:
-     * 1. Try each empty cell
-     * 2. Count how many three-in-a-rows result
-     * 3. Pick cell with best count
+     * Prompts for row and column (0-4).
      *
      * @param player Pointer to player making move
-     * @return Pointer to Move object with position and symbol
+     * @return Move object with position and symbol
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
\ No newline at end of file
@@ -4,18 +4,30 @@
 #include <iomanip>
 #include <cctype>  // for toupper()
 #include "Tic_Tac_Toe_4x4.h"
+#include "WinLines.h"
 #include <cstdlib>
 
 using namespace std;
 
+// Every three-in-a-row of the 4x4 grid, as masks over marks_of()
+static constexpr WinLines<4, 4, 3> slide_lines;
+
 //--------------------------------------- Tic_Tac_Toe_4x4_Board Implementation
 
-Tic_Tac_Toe_4x4_Board::Tic_Tac_Toe_4x4_Board() : Board(4, 4) {
+Tic_Tac_Toe_4x4_Board::Tic_Tac_Toe_4x4_Board() : XOBoardBase(4, 4) {
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void Tic_Tac_Toe_4x4_Board::reset() {
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    history.clear();
+    positions.clear();
+
     // Initialize all cells with blank_symbol
-    for (auto& row : board) {
-        for (auto& cell : row){
-            cell = blank_symbol;}
-    }
+    board.fill(blank_symbol);
     for (int i=0;i<=3;i+=3){
         for (int j = 0; j <= 3; j++) {
             if ((i + j) % 2 == 0) {
@@ -26,70 +38,113 @@ Tic_Tac_Toe_4x4_Board::Tic_Tac_Toe_4x4_Board() : Board(4, 4) {
                 board[i][j] = 'X';
 
             }
+            hash ^= zobrist.cell(i, j, board[i][j] == 'X' ? 0 : 1);
+            toggle_mark(i, j, board[i][j]);
     }
     
     }
+    positions.push_back(hash);
+}
+
+void Tic_Tac_Toe_4x4_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    static const int dx[] = { -1, 1, 0, 0 };
+    static const int dy[] = { 0, 0, -1, 1 };
+
+    moves.clear();
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < columns; ++j) {
+            if (board[i][j] != symbol) continue;
+            for (int d = 0; d < 4; ++d) {
+                int x = i + dx[d];
+                int y = j + dy[d];
+                if (x >= 0 && x < rows && y >= 0 && y < columns && board[x][y] == blank_symbol)
+                    moves.add(Move<char>(i, j, x, y, symbol));
+            }
+        }
+    }
 }
 
 
 
 
 bool Tic_Tac_Toe_4x4_Board::update_board(Move<char>* move) {
-    int oldx = move[0].get_x();
-    int newx = move[1].get_x();
-    int oldy = move[0].get_y();
-    int newy = move[1].get_y();
-    char mark = move[1].get_symbol();
+    int oldx = move->get_from_x();
+    int newx = move->get_x();
+    int oldy = move->get_from_y();
+    int newy = move->get_y();
+    char mark = move->get_symbol();
     
     // Validate move and apply if valid
-    if (!(newx < 0 || newx >= rows || newy < 0 || newy >= columns) &&
-        (board[newx][newy] == blank_symbol) && (((newy == oldy) && (abs(newx - oldx) == 1)) || ((newx == oldx) && (abs(oldy - newy == 1)))) && (board[oldx][oldy]==mark)) {
+    if (!(oldx < 0 || oldx >= rows || oldy < 0 || oldy >= columns) &&
+        !(newx < 0 || newx >= rows || newy < 0 || newy >= columns) &&
+        (board[newx][newy] == blank_symbol) && (((newy == oldy) && (abs(newx - oldx) == 1)) || ((newx == oldx) && (abs(oldy - newy) == 1))) && (board[oldx][oldy]==mark)) {
 
 		board[oldx][oldy] = blank_symbol;
 		board[newx][newy] = mark;
-        
-        
+        n_moves++;
+        hash ^= zobrist.cell(oldx, oldy, mark == 'X' ? 0 : 1);
+        toggle_mark(oldx, oldy, mark);
+        hash_xo_move(newx, newy, mark);
+        history.push_back(*move);
+        positions.push_back(hash);
+
         return true;
     }
     return false;
 }
 
-bool Tic_Tac_Toe_4x4_Board::is_win(Player<char>* player) {
-    const char sym = player->get_symbol();
+bool Tic_Tac_Toe_4x4_Board::undo_move() {
+    if (history.empty()) return false;
+
+    Move<char> slide = history.back();
+    history.pop_back();
+    positions.pop_back();
+    board[slide.get_x()][slide.get_y()] = blank_symbol;
+    board[slide.get_from_x()][slide.get_from_y()] = slide.get_symbol();
+    n_moves--;
+    hash ^= zobrist.cell(slide.get_from_x(), slide.get_from_y(), slide.get_symbol() == 'X' ? 0 : 1);
+    toggle_mark(slide.get_from_x(), slide.get_from_y(), slide.get_symbol());
+    hash_xo_move(slide.get_x(), slide.get_y(), slide.get_symbol());
+    return true;
+}
 
-    auto all_equal = [&](char a, char b, char c) {
-        return a == b && b == c && a != blank_symbol;
-        };
+bool Tic_Tac_Toe_4x4_Board::is_win(Player<char>* player) {
+    return slide_lines.any(marks_of(player->get_symbol()));
+}
 
-    // Check rows and columns
-    for (int i = 0; i < rows; i++) {
-        if((all_equal(board[i][0],board[i][1],board[i][2])&&board[i][0]==sym) || ( all_equal(board[0][i], board[1][i], board[2][i]) && board[0][i] == sym))
-    
-			return true;
-    }
-    for (int i = 0; i < rows; i++) {
-        if ((all_equal(board[i][1], board[i][2], board[i][3]) && board[i][1] == sym) || (all_equal(board[1][i], board[2][i], board[3][i]) && board[1][i] == sym)) 
-
-                return true;
-     }
-    // Check diagonals
-    for (int n = 0; n < 2; n++) {
-        for (int j = 0; j < 2; j++) {
-            if ((all_equal(board[0+j][0+n], board[1+j][1+n], board[2+j][2+n]) && board[1+j][1+n] == sym) ||
-                (all_equal(board[0+j][2+n], board[1+j][1+n], board[2+j][0+n]) && board[1+j][1+n] == sym))
-                return true;
-        }
-    }
+bool Tic_Tac_Toe_4x4_Board::drawn_by_rule() const {
+    if (n_moves >= MAX_MOVES) return true;
 
-    return false;
+    // The hash includes the side to move, so only positions with the same
+    // player to move can match
+    int seen = 0;
+    for (size_t i = 0; i + 1 < positions.size(); ++i)
+        seen += positions[i] == hash;
+    return seen >= 2;
 }
 
 bool Tic_Tac_Toe_4x4_Board::is_draw(Player<char>* player) {
-    return false;
+    if (is_win(player)) return false;
+    if (drawn_by_rule()) return true;
+
+    MoveList<char> replies;
+    generate_moves(player->get_symbol() == 'X' ? 'O' : 'X', replies);
+    return replies.empty();
 }
 
 bool Tic_Tac_Toe_4x4_Board::game_is_over(Player<char>* player) {
-    return is_win(player) ;
+    return is_win(player) || is_draw(player);
+}
+
+Outcome Tic_Tac_Toe_4x4_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (slide_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    if (drawn_by_rule()) return Outcome::DRAW;
+
+    MoveList<char> replies;
+    generate_moves(last_move.get_symbol() == 'X' ? 'O' : 'X', replies);
+    return replies.empty() ? Outcome::DRAW : Outcome::ONGOING;
 }
 
 //--------------------------------------- Tic_Tac_Toe_4x4_UI Implementation
@@ -104,22 +159,12 @@ Player<char>* Tic_Tac_Toe_4x4_UI::create_player(string& name, char symbol, Playe
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Tic_Tac_Toe_4x4_UI::get_move(Player<char>* player) {
+Move<char> Tic_Tac_Toe_4x4_UI::get_move(Player<char>* player) {
     int x1,y1,x2,y2;
   
-    if (player->get_type() == PlayerType::HUMAN) {
-       cout << player->get_name() <<"("<<player->get_symbol()<<")"  << "'s turn. Enter the coordinates of the piece to move (row and column): \n";
-        cin >> x1 >> y1 ;
-        cout << player->get_name() << "(" << player->get_symbol() << ")" << "'s turn. Enter the coordinates of the place to move (row and column):\n ";
-		cin >> x2 >> y2;
-  
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        x1 = rand() % player->get_board_ptr()->get_rows();
-        x2 = rand() % player->get_board_ptr()->get_rows();
-        y1 = rand() % player->get_board_ptr()->get_columns();
-        y2 = rand() % player->get_board_ptr()->get_columns();
-    }
-    Move<char>* moves = new Move<char>[2] { Move<char>(x1, y1, 0), Move<char>(x2, y2, player->get_symbol()) };
-    return moves;
+    cout << player->get_name() <<"("<<player->get_symbol()<<")"  << "'s turn. Enter the coordinates of the piece to move (row and column): \n";
+    cin >> x1 >> y1 ;
+    cout << player->get_name() << "(" << player->get_symbol() << ")" << "'s turn. Enter the coordinates of the place to move (row and column):\n ";
+    cin >> x2 >> y2;
+    return Move<char>(x1, y1, x2, y2, player->get_symbol());
 }
\ No newline at end of file
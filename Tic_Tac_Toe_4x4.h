@@ -11,6 +11,7 @@
 #define Tic_Tac_Toe_4x4_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 using namespace std;
 
 /**
@@ -23,11 +24,26 @@ using namespace std;
  *
  * @see Board
  */
-class Tic_Tac_Toe_4x4_Board : public Board<char> {
+class Tic_Tac_Toe_4x4_Board final : public XOBoardBase {
 private:
     char blank_symbol = '.'; ///< Character used to represent an empty cell on the board.
+    vector<Move<char>> history; ///< Applied slides, oldest first (for undo_move)
+    vector<uint64_t> positions; ///< Hash of every position since reset(), the current one last
+
+    /**
+     * @brief Whether the current position is drawn by rule: it has now
+     * occurred three times, or the game has reached MAX_MOVES.
+     */
+    bool drawn_by_rule() const;
 
 public:
+    /**
+     * @brief Slides after which the game is a draw. Pieces never leave the
+     * board, so without a limit two players who both avoid losing could
+     * slide back and forth forever.
+     */
+    static const int MAX_MOVES = 100;
+
     /**
      * @brief Default constructor that initializes a 3x3 Tic_Tac_Toe_4x4 board.
      */
@@ -56,8 +72,13 @@ public:
 
     /**
      * @brief Checks if the game has ended in a draw.
-     * @param player Pointer to the player being checked.
-     * @return true if all cells are filled and no player has won, false otherwise.
+     *
+     * The board never fills, so a draw is a stalemate (the player who did
+     * not just move has no legal slide), a position occurring for the third
+     * time, or MAX_MOVES slides played.
+     *
+     * @param player Pointer to the player who just moved.
+     * @return true if one of those holds and the player has not won, false otherwise.
      */
     bool is_draw(Player<char>* player);
 
@@ -67,6 +88,37 @@ public:
      * @return true if the game has ended, false otherwise.
      */
     bool game_is_over(Player<char>* player);
+
+    /**
+     * @brief Checks only the lines through the square the piece slid to,
+     * then the draw rules of is_draw().
+     * @param last_move The slide just applied.
+     * @return WIN for three in a row, DRAW if the opponent cannot move, the
+     * position has occurred three times or MAX_MOVES is reached, else ONGOING.
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to the starting rows of pieces.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new Tic_Tac_Toe_4x4_Board(*this); }
+
+    /**
+     * @brief Lists every one-step horizontal or vertical slide of
+     * one of `symbol`'s pieces into an empty cell.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board(). Slides the piece back.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 };
 
 
@@ -105,9 +157,9 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      * @param player Pointer to the player whose move is being requested.
-     * @return A pointer to a new `Move<char>` object representing the player's action.
+     * @return A `Move<char>` value representing the player's action.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 };
 
 #endif // Tic_Tac_Toe_4x4_H
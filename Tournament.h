@@ -0,0 +1,253 @@
+/**
+ * @file Tournament.h
+ * @brief Runs many computer-vs-computer games in parallel.
+ *
+ * This file provides:
+ * - `ThreadPool`: A fixed set of worker threads with one work-stealing
+ *   queue per worker.
+ * - `Tournament`: Plays a large number of independent headless games of one
+ *   variant across all cores and aggregates the results.
+ *
+ * Every task builds its own UI, board and players, so workers never share
+ * game state. Results are counted per worker and only summed after all
+ * workers have joined.
+ */
+
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include "BoardGame_Classes.h"
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <memory>
+#include <functional>
+
+using namespace std;
+
+/**
+ * @class ThreadPool
+ * @brief Worker threads that drain a set of work-stealing queues.
+ *
+ * Tasks are queued round-robin before the pool starts. Each worker takes
+ * tasks from the back of its own queue and, once that is empty, steals from
+ * the front of the other workers' queues. Tasks are handed the index of the
+ * worker running them so they can write to per-worker storage without
+ * synchronisation.
+ */
+class ThreadPool {
+    /** @brief One worker's queue, padded so neighbouring locks do not share a cache line. */
+    struct WorkerQueue {
+        mutex lock;                         ///< Guards tasks
+        deque<function<void(int)>> tasks;   ///< Pending tasks for this worker
+        char padding[64];                   ///< Keeps the next queue off this cache line
+    };
+
+    vector<unique_ptr<WorkerQueue>> queues; ///< One queue per worker
+    size_t next_queue = 0;                  ///< Round-robin cursor for submit()
+
+    /** @brief Take a task from the back of queue q. */
+    bool pop_own(int q, function<void(int)>& task) {
+        lock_guard<mutex> guard(queues[q]->lock);
+        if (queues[q]->tasks.empty()) return false;
+        task = move(queues[q]->tasks.back());
+        queues[q]->tasks.pop_back();
+        return true;
+    }
+
+    /** @brief Take a task from the front of queue q on behalf of another worker. */
+    bool steal(int q, function<void(int)>& task) {
+        lock_guard<mutex> guard(queues[q]->lock);
+        if (queues[q]->tasks.empty()) return false;
+        task = move(queues[q]->tasks.front());
+        queues[q]->tasks.pop_front();
+        return true;
+    }
+
+    /** @brief Worker loop: drain own queue, then steal until every queue is empty. */
+    void work(int id) {
+        int n = static_cast<int>(queues.size());
+        function<void(int)> task;
+        while (true) {
+            bool found = pop_own(id, task);
+            for (int k = 1; !found && k < n; ++k)
+                found = steal((id + k) % n, task);
+            if (!found) return;
+            task(id);
+        }
+    }
+
+public:
+    /**
+     * @brief Create a pool with n_threads workers (at least one).
+     */
+    explicit ThreadPool(int n_threads) {
+        if (n_threads < 1) n_threads = 1;
+        for (int i = 0; i < n_threads; ++i)
+            queues.emplace_back(new WorkerQueue());
+    }
+
+    /** @brief Number of worker threads. */
+    int size() const { return static_cast<int>(queues.size()); }
+
+    /**
+     * @brief Queue a task. It receives the index of the worker that runs it.
+     */
+    void submit(function<void(int)> task) {
+        queues[next_queue]->tasks.push_back(move(task));
+        next_queue = (next_queue + 1) % queues.size();
+    }
+
+    /**
+     * @brief Run all queued tasks and return when every one has finished.
+     *
+     * Tasks must not submit new tasks while the pool is running.
+     */
+    void run() {
+        vector<thread> workers;
+        for (int i = 1; i < size(); ++i)
+            workers.emplace_back(&ThreadPool::work, this, i);
+        work(0);
+        for (auto& w : workers)
+            w.join();
+    }
+};
+
+/**
+ * @brief Aggregated outcome of a tournament.
+ */
+struct TournamentResult {
+    long games = 0;        ///< Games played
+    long wins[2] = { 0, 0 }; ///< Wins by player index 0 and 1
+    long draws = 0;        ///< Drawn games
+    long moves = 0;        ///< Total accepted moves over all games
+    double seconds = 0.0;  ///< Wall-clock time of the whole tournament
+    GameStats stats;       ///< Turn timings of all games; empty unless built with BOARDGAME_STATS
+
+    /** @brief Throughput of the tournament. */
+    double games_per_second() const { return seconds > 0 ? games / seconds : 0.0; }
+};
+
+/**
+ * @class Tournament
+ * @brief Plays many independent headless games of one variant on all cores.
+ *
+ * @tparam T Type of symbol used on the board.
+ *
+ * The tournament is given factories instead of objects: every task creates
+ * its own UI, board and two players, plays a chunk of games on them with
+ * GameManager::play_headless (resetting the board between games), then
+ * deletes them. Each worker adds its results to its own padded counter
+ * block, so no locks or atomics are taken per game.
+ *
+ * Game i is seeded with RandomEngine::derive(seed, i) whichever worker plays
+ * it, so the totals for a given seed do not depend on the thread count.
+ */
+template <typename T>
+class Tournament {
+public:
+    typedef function<UI<T>*()> UIFactory;                  ///< Creates a UI for one task
+    typedef function<Board<T>*()> BoardFactory;            ///< Creates a board for one task
+    typedef function<Player<T>*(UI<T>*, int)> PlayerFactory; ///< Creates player 0 or 1 for one task
+
+private:
+    /** @brief Per-worker result counters, padded so workers never share a cache line. */
+    struct WorkerCounters {
+        long games = 0;
+        long wins[2] = { 0, 0 };
+        long draws = 0;
+        long moves = 0;
+        GameStats stats;
+        char padding[64];
+    };
+
+    UIFactory make_ui;         ///< Builds a UI per task
+    BoardFactory make_board;   ///< Builds a board per task
+    PlayerFactory make_player; ///< Builds the two players per task
+
+public:
+    /**
+     * @brief Construct a tournament from factories for its game objects.
+     *
+     * @param ui Creates the UI the players are created through.
+     * @param board Creates a fresh board.
+     * @param player Creates player 0 or 1 (the second argument) for a UI.
+     */
+    Tournament(UIFactory ui, BoardFactory board, PlayerFactory player)
+        : make_ui(ui), make_board(board), make_player(player) {
+    }
+
+    /**
+     * @brief Play n_games games spread over n_threads workers.
+     *
+     * Output printed by the games is discarded for the duration of the run.
+     *
+     * @param n_games Total number of games to play.
+     * @param n_threads Worker threads; 0 uses every hardware thread.
+     * @param games_per_task Games played on one board/player set before it is rebuilt.
+     * @param seed Tournament seed the per-game seeds are derived from.
+     * @return Summed results and the wall time of the whole run.
+     */
+    TournamentResult run(long n_games, int n_threads = 0, int games_per_task = 64,
+        uint64_t seed = 0) {
+        if (n_threads <= 0) n_threads = static_cast<int>(thread::hardware_concurrency());
+        if (n_threads <= 0) n_threads = 1;
+        if (games_per_task < 1) games_per_task = 1;
+
+        ThreadPool pool(n_threads);
+        vector<WorkerCounters> counters(pool.size());
+
+        for (long first = 0; first < n_games; first += games_per_task) {
+            long count = min<long>(games_per_task, n_games - first);
+            pool.submit([this, first, count, seed, &counters](int worker) {
+                play_chunk(first, count, seed, counters[worker]);
+            });
+        }
+
+        TournamentResult result;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        {
+            SilentOutput silence;
+            pool.run();
+        }
+        result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        for (const WorkerCounters& c : counters) {
+            result.games += c.games;
+            result.wins[0] += c.wins[0];
+            result.wins[1] += c.wins[1];
+            result.draws += c.draws;
+            result.moves += c.moves;
+            result.stats.merge(c.stats);
+        }
+        return result;
+    }
+
+private:
+    /** @brief Build one game set, play games first..first+count-1 on it and tear it down. */
+    void play_chunk(long first, long count, uint64_t seed, WorkerCounters& out) {
+        UI<T>* ui = make_ui();
+        Board<T>* board = make_board();
+        Player<T>* players[2] = { make_player(ui, 0), make_player(ui, 1) };
+        ui->set_headless(true);
+
+        GameManager<T> manager(board, players, ui);
+        for (long g = 0; g < count; ++g) {
+            manager.seed(RandomEngine::derive(seed, first + g));
+            board->reset();
+            GameResult r = manager.play_headless();
+            out.games++;
+            out.moves += r.moves;
+            if (r.winner < 0) out.draws++;
+            else out.wins[r.winner]++;
+        }
+        out.stats.merge(manager.get_stats());
+
+        delete players[0];
+        delete players[1];
+        delete board;
+        delete ui;
+    }
+};
+
+#endif // TOURNAMENT_H
@@ -0,0 +1,164 @@
+/**
+ * @file TranspositionTable.h
+ * @brief Fixed-size hash table of search results, shared lock-free by threads.
+ *
+ * This file provides:
+ * - `Bound`: What a stored search score means relative to the true value.
+ * - `TranspositionTable`: Buckets of two slots keyed by a position hash
+ *   (see Board::get_hash()), safe to probe and store from many threads at
+ *   once without locks.
+ *
+ * Each slot keeps its entry packed into one 64-bit word next to a check
+ * word holding the key XOR the packed entry. Two threads writing the same
+ * slot can interleave and leave one thread's key with the other's entry;
+ * the check then fails to decode to the probed key and the slot reads as a
+ * miss, so a torn slot is never returned.
+ */
+
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+using namespace std;
+
+/**
+ * @brief How a stored score relates to the position's true value.
+ *
+ * An alpha-beta search that fails high only proves a lower bound, and one
+ * that fails low only an upper bound.
+ */
+enum class Bound : uint8_t { EXACT, LOWER, UPPER };
+
+/**
+ * @class TranspositionTable
+ * @brief Lock-free table of search entries with a depth-preferred and an
+ * always-replace slot per bucket.
+ *
+ * @tparam Key Position hash; an unsigned 64-bit integer.
+ * @tparam Entry What is stored per position. Must be trivially copyable, at
+ * most 8 bytes, and have an integer `depth` member: the depth of the search
+ * that produced it. Deeper entries are kept in preference to shallower ones.
+ *
+ * A store goes to the bucket's first slot if that slot holds the same key
+ * or an entry searched no deeper than the new one, and to the second slot
+ * otherwise. Deep results therefore survive, while the second slot always
+ * keeps the latest shallow result.
+ */
+template <typename Key, typename Entry>
+class TranspositionTable {
+    static_assert(is_integral<Key>::value && is_unsigned<Key>::value && sizeof(Key) == sizeof(uint64_t),
+        "TranspositionTable keys must be 64-bit unsigned hashes");
+    static_assert(is_trivially_copyable<Entry>::value && sizeof(Entry) <= sizeof(uint64_t),
+        "TranspositionTable entries must pack into 64 bits");
+
+    /** @brief One stored entry and its check word. */
+    struct Slot {
+        atomic<uint64_t> check; ///< Key XOR data
+        atomic<uint64_t> data;  ///< The packed entry
+    };
+
+    /** @brief Depth-preferred slot, then always-replace slot, on one cache line half. */
+    struct alignas(32) Bucket {
+        Slot slots[2];
+    };
+
+    // An empty slot holds data 0 and this check, so it only matches the key
+    // ~EMPTY_CHECK, which a 64-bit hash hits with negligible probability
+    static const uint64_t EMPTY_CHECK = 0x9E3779B97F4A7C15ULL;
+
+    // operator new only guarantees alignas(32) from C++17 on, so the
+    // buckets are placed by hand in a slightly larger block
+    unique_ptr<char[]> storage; ///< Owns the memory the buckets live in
+    Bucket* buckets = nullptr;  ///< The table, aligned to 32 bytes inside storage
+    size_t mask = 0;            ///< Number of buckets - 1 (a power of two)
+
+    static uint64_t pack(const Entry& entry) {
+        uint64_t data = 0;
+        memcpy(&data, &entry, sizeof(Entry));
+        return data;
+    }
+
+    static Entry unpack(uint64_t data) {
+        Entry entry;
+        memcpy(&entry, &data, sizeof(Entry));
+        return entry;
+    }
+
+public:
+    /**
+     * @brief Create a table using at most `megabytes` MB (at least one bucket).
+     *
+     * The bucket count is rounded down to a power of two.
+     */
+    explicit TranspositionTable(size_t megabytes = 1) {
+        size_t count = megabytes * 1024 * 1024 / sizeof(Bucket);
+        size_t n = 1;
+        while (n * 2 <= count) n *= 2;
+        storage.reset(new char[n * sizeof(Bucket) + alignof(Bucket) - 1]);
+        uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+        address = (address + alignof(Bucket) - 1) & ~uintptr_t(alignof(Bucket) - 1);
+        buckets = reinterpret_cast<Bucket*>(address);
+        for (size_t i = 0; i < n; ++i)
+            new (&buckets[i]) Bucket;
+        mask = n - 1;
+        clear();
+    }
+
+    /** @brief Number of buckets (two entries each). */
+    size_t size() const { return mask + 1; }
+
+    /**
+     * @brief Empty every slot. Not safe while other threads use the table.
+     */
+    void clear() {
+        for (size_t i = 0; i <= mask; ++i)
+            for (Slot& slot : buckets[i].slots) {
+                slot.data.store(0, memory_order_relaxed);
+                slot.check.store(EMPTY_CHECK, memory_order_relaxed);
+            }
+    }
+
+    /**
+     * @brief Look up a position.
+     * @param key Hash of the position.
+     * @param entry Receives the stored entry on a hit.
+     * @return true if an entry for key was found.
+     */
+    bool probe(Key key, Entry& entry) const {
+        const Bucket& bucket = buckets[key & mask];
+        for (const Slot& slot : bucket.slots) {
+            uint64_t data = slot.data.load(memory_order_relaxed);
+            if ((slot.check.load(memory_order_relaxed) ^ data) == key) {
+                entry = unpack(data);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Store the result of searching a position.
+     *
+     * Concurrent stores to the same bucket may overwrite one another; the
+     * table is a cache, and a lost entry only costs a re-search.
+     */
+    void store(Key key, const Entry& entry) {
+        Bucket& bucket = buckets[key & mask];
+        Slot& deep = bucket.slots[0];
+        uint64_t deep_data = deep.data.load(memory_order_relaxed);
+        bool same_key = (deep.check.load(memory_order_relaxed) ^ deep_data) == key;
+
+        Slot& slot = (same_key || unpack(deep_data).depth <= entry.depth) ? deep : bucket.slots[1];
+        uint64_t data = pack(entry);
+        slot.data.store(data, memory_order_relaxed);
+        slot.check.store(key ^ data, memory_order_relaxed);
+    }
+};
+
+#endif // TRANSPOSITION_TABLE_H
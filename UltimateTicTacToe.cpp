@@ -1,20 +1,34 @@
 #include "UltimateTicTacToe.h"
+#include "WinLines.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 using namespace std;
 
-MiniBoard::MiniBoard() : Board<char>(3, 3) {
+// Rows, columns and diagonals of a 3x3 mini-board, as masks over marks_of()
+static constexpr WinLines<3, 3, 3> mini_lines;
+
+MiniBoard::MiniBoard() : XOBoardBase(3, 3) {
+    // a separate key stream, as the meta-board folds this hash into its own
+    zobrist = ZobristKeys(rows, columns, 2, 0, 1);
     reset();
 }
 
 void MiniBoard::reset() {
     n_moves = 0;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            board[i][j] = blank_symbol;
-        }
-    }
+    hash = 0;
+    marks[0] = marks[1] = 0;
+    board.fill(blank_symbol);
+    history.clear();
+}
+
+void MiniBoard::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool MiniBoard::update_board(Move<char>* move) {
@@ -26,37 +40,26 @@ bool MiniBoard::update_board(Move<char>* move) {
     if (board[x][y] != blank_symbol) return false;
 
     board[x][y] = symbol;
+    hash_xo_move(x, y, symbol);
     n_moves++;
+    history.push_back({ x, y });
     return true;
 }
 
-char MiniBoard::check_winner() {
-    for (int i = 0; i < 3; i++) {
-        if (board[i][0] != blank_symbol &&
-            board[i][0] == board[i][1] &&
-            board[i][1] == board[i][2]) {
-            return board[i][0];
-        }
-    }
+bool MiniBoard::undo_move() {
+    if (history.empty()) return false;
 
-    for (int j = 0; j < 3; j++) {
-        if (board[0][j] != blank_symbol &&
-            board[0][j] == board[1][j] &&
-            board[1][j] == board[2][j]) {
-            return board[0][j];
-        }
-    }
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
 
-    if (board[0][0] != blank_symbol &&
-        board[0][0] == board[1][1] &&
-        board[1][1] == board[2][2]) {
-        return board[0][0];
-    }
-    if (board[0][2] != blank_symbol &&
-        board[0][2] == board[1][1] &&
-        board[1][1] == board[2][0]) {
-        return board[0][2];
-    }
+char MiniBoard::check_winner() {
+    if (mini_lines.any(marks[0])) return 'X';
+    if (mini_lines.any(marks[1])) return 'O';
 
     if (n_moves >= 9) return 'D';
 
@@ -76,28 +79,58 @@ bool MiniBoard::game_is_over(Player<char>* player) {
     return winner != 0;
 }
 
+Outcome MiniBoard::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (mini_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return n_moves >= 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 UltimateTicTacToe_Board::UltimateTicTacToe_Board()
-    : Board<char>(3, 3), active_board_x(-1), active_board_y(-1),
-    first_move(true), current_player(nullptr), sub_game_in_progress(false),
-    last_cell_x(-1), last_cell_y(-1) {
+    : Board<char>(3, 3) {
+    // main-board results (X, O, draw); extra keys are used by meta_key()
+    zobrist = ZobristKeys(3, 3, 3, 14);
+    reset();
+}
 
+void UltimateTicTacToe_Board::reset() {
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
             main_board[i][j] = 0;
         }
     }
+    active_board_x = -1;
+    active_board_y = -1;
+    first_move = true;
+    current_symbol = 0;
+    sub_game_in_progress = false;
+    last_cell_x = -1;
+    last_cell_y = -1;
+    mini_board_X.reset();
+    mini_board_O.reset();
+    history.clear();
+    hash = meta_key();
 }
 
-void UltimateTicTacToe_Board::start_sub_game(int board_x, int board_y, Player<char>* player) {
+bool UltimateTicTacToe_Board::can_start_sub_game(int board_x, int board_y) const {
+    if (board_x < 0 || board_x >= 3 || board_y < 0 || board_y >= 3) return false;
+    if (!is_position_available(board_x, board_y)) return false;
+
+    bool forced = active_board_x != -1 && is_position_available(active_board_x, active_board_y);
+    return !forced || (board_x == active_board_x && board_y == active_board_y);
+}
+
+void UltimateTicTacToe_Board::start_sub_game(int board_x, int board_y, char symbol) {
     active_board_x = board_x;
     active_board_y = board_y;
-    current_player = player;
+    current_symbol = symbol;
     sub_game_in_progress = true;
+    first_move = false;
 
-    if (player && player->get_symbol() == 'X') {
+    if (symbol == 'X') {
         mini_board_X.reset();
     }
-    else if (player) {
+    else {
         mini_board_O.reset();
     }
 }
@@ -112,13 +145,13 @@ void UltimateTicTacToe_Board::end_sub_game() {
         active_board_x = -1;
         active_board_y = -1;
     }
-    current_player = nullptr;
+    current_symbol = 0;
 }
 
 MiniBoard* UltimateTicTacToe_Board::get_current_mini_board() {
-    if (!current_player) return nullptr;
+    if (!current_symbol) return nullptr;
 
-    if (current_player->get_symbol() == 'X') {
+    if (current_symbol == 'X') {
         return &mini_board_X;
     }
     else {
@@ -126,27 +159,132 @@ MiniBoard* UltimateTicTacToe_Board::get_current_mini_board() {
     }
 }
 
-bool UltimateTicTacToe_Board::update_board(Move<char>* move) {
+void UltimateTicTacToe_Board::generate_moves(char symbol, MoveList<char>& moves) {
     if (sub_game_in_progress) {
-        MiniBoard* mini = get_current_mini_board();
-        if (mini && mini->update_board(move)) {
-            last_cell_x = move->get_x();
-            last_cell_y = move->get_y();
-
-            if (mini->game_is_over(current_player)) {
-                char winner = mini->check_winner();
-                if (winner == 'D') {
-                    main_board[active_board_x][active_board_y] = 'D';
-                }
-                else {
-                    main_board[active_board_x][active_board_y] = winner;
-                }
-                end_sub_game();
+        get_current_mini_board()->generate_moves(symbol, moves);
+        return;
+    }
+
+    moves.clear();
+    for (int bx = 0; bx < 3; ++bx)
+        for (int by = 0; by < 3; ++by)
+            if (can_start_sub_game(bx, by))
+                for (int x = 0; x < 3; ++x)
+                    for (int y = 0; y < 3; ++y)
+                        moves.add(Move<char>(bx, by, x, y, symbol));
+}
+
+void UltimateTicTacToe_Board::save_state(UndoEntry& entry) const {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            entry.main_board[i][j] = main_board[i][j];
+    entry.active_board_x = active_board_x;
+    entry.active_board_y = active_board_y;
+    entry.first_move = first_move;
+    entry.current_symbol = current_symbol;
+    entry.sub_game_in_progress = sub_game_in_progress;
+    entry.last_cell_x = last_cell_x;
+    entry.last_cell_y = last_cell_y;
+}
+
+void UltimateTicTacToe_Board::restore_state(const UndoEntry& entry) {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            main_board[i][j] = entry.main_board[i][j];
+    active_board_x = entry.active_board_x;
+    active_board_y = entry.active_board_y;
+    first_move = entry.first_move;
+    current_symbol = entry.current_symbol;
+    sub_game_in_progress = entry.sub_game_in_progress;
+    last_cell_x = entry.last_cell_x;
+    last_cell_y = entry.last_cell_y;
+}
+
+bool UltimateTicTacToe_Board::update_board(Move<char>* move) {
+    UndoEntry entry;
+    save_state(entry);
+    entry.started = false;
+    entry.hash = hash;
+    uint64_t meta_before = meta_key();
+
+    if (!sub_game_in_progress) {
+        int board_x = move->get_from_x();
+        int board_y = move->get_from_y();
+        if (board_x == -1 && board_y == -1) {
+            board_x = active_board_x;
+            board_y = active_board_y;
+        }
+
+        int x = move->get_x();
+        int y = move->get_y();
+        if (x < 0 || x >= 3 || y < 0 || y >= 3) return false;
+        if (!can_start_sub_game(board_x, board_y)) return false;
+
+        // Starting resets the mini-board, so keep what it held for undo_move()
+        MiniBoard& fresh = (move->get_symbol() == 'X') ? mini_board_X : mini_board_O;
+        entry.started = true;
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                entry.mini_cells[i][j] = fresh.board[i][j];
+        entry.mini_moves = fresh.n_moves;
+        // Copied rather than swapped, so the mini-board keeps its capacity
+        entry.mini_history_size = static_cast<int>(fresh.history.size());
+        copy(fresh.history.begin(), fresh.history.end(), entry.mini_history);
+        entry.mini_hash = fresh.hash;
+        entry.mini_marks[0] = fresh.marks[0];
+        entry.mini_marks[1] = fresh.marks[1];
+
+        start_sub_game(board_x, board_y, move->get_symbol());
+    }
+    entry.mini_symbol = current_symbol;
+
+    // Only the mini-board in progress is part of the position
+    MiniBoard* mini = get_current_mini_board();
+    uint64_t mini_before = mini ? mini->hash : 0;
+    if (mini && mini->update_board(move)) {
+        hash ^= mini_before ^ mini->hash;
+        last_cell_x = move->get_x();
+        last_cell_y = move->get_y();
+        history.push_back(std::move(entry));
+
+        if (mini->game_is_over(nullptr)) {
+            char winner = mini->check_winner();
+            if (winner == 'D') {
+                main_board[active_board_x][active_board_y] = 'D';
             }
-            return true;
+            else {
+                main_board[active_board_x][active_board_y] = winner;
+            }
+            hash ^= zobrist.cell(active_board_x, active_board_y,
+                                 result_piece(main_board[active_board_x][active_board_y])) ^ mini->hash;
+            end_sub_game();
         }
-        return false;
+        hash ^= meta_before ^ meta_key() ^ zobrist.side();
+        return true;
+    }
+    return false;
+}
+
+bool UltimateTicTacToe_Board::undo_move() {
+    if (history.empty()) return false;
+
+    UndoEntry& entry = history.back();
+    MiniBoard& mini = (entry.mini_symbol == 'X') ? mini_board_X : mini_board_O;
+
+    mini.undo_move();
+    if (entry.started) {
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                mini.board[i][j] = entry.mini_cells[i][j];
+        mini.n_moves = entry.mini_moves;
+        mini.history.assign(entry.mini_history, entry.mini_history + entry.mini_history_size);
+        mini.hash = entry.mini_hash;
+        mini.marks[0] = entry.mini_marks[0];
+        mini.marks[1] = entry.mini_marks[1];
     }
+    restore_state(entry);
+    hash = entry.hash;
+    history.pop_back();
     return true;
 }
 
@@ -205,6 +343,14 @@ bool UltimateTicTacToe_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome UltimateTicTacToe_Board::evaluate_outcome(const Move<char>& last_move) {
+    if (sub_game_in_progress) return Outcome::ONGOING;
+
+    if (check_main_board_win(last_move.get_symbol()))
+        return Outcome::WIN;
+    return is_main_board_full() ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 UltimateTicTacToe_UI::UltimateTicTacToe_UI()
     : UI<char>("Welcome to Ultimate Tic-Tac-Toe!", 3) {
     cout << "\n=== ULTIMATE TIC-TAC-TOE RULES ===\n";
@@ -214,6 +360,7 @@ UltimateTicTacToe_UI::UltimateTicTacToe_UI()
     cout << "4. Win the small board, and you claim that position on the main board\n";
     cout << "5. The position you win determines where your opponent plays next\n";
     cout << "6. Win the game by winning 3 positions in a row on the main board!\n\n";
+    type_options.push_back("MCTS AI");
 }
 
 Player<char>* UltimateTicTacToe_UI::create_player(string& name, char symbol, PlayerType type) {
@@ -221,6 +368,7 @@ Player<char>* UltimateTicTacToe_UI::create_player(string& name, char symbol, Pla
 }
 
 void UltimateTicTacToe_UI::display_main_board(UltimateTicTacToe_Board* board) {
+    if (headless) return;
     system("cls");
 
     cout << "\n=== MAIN BOARD STATUS ===\n";
@@ -251,7 +399,7 @@ void UltimateTicTacToe_UI::display_mini_board(MiniBoard* mini_board, int board_x
     cout << "   0   1   2\n";
     cout << " +---+---+---+\n";
 
-    auto matrix = mini_board->get_board_matrix();
+    BoardView<char> matrix = mini_board->get_board_view();
     for (int i = 0; i < 3; i++) {
         cout << i << "|";
         for (int j = 0; j < 3; j++) {
@@ -268,92 +416,64 @@ void UltimateTicTacToe_UI::display_mini_board(MiniBoard* mini_board, int board_x
     cout << endl;
 }
 
-Move<char>* UltimateTicTacToe_UI::get_move(Player<char>* player) {
+Move<char> UltimateTicTacToe_UI::get_move(Player<char>* player) {
     UltimateTicTacToe_Board* ult_board = dynamic_cast<UltimateTicTacToe_Board*>(player->get_board_ptr());
 
     if (!ult_board) {
         cerr << "Error: Invalid board type!\n";
-        return nullptr;
+        return Move<char>();
     }
 
-    if (!ult_board->is_sub_game_in_progress()) {
-        int board_x = ult_board->get_active_board_x();
-        int board_y = ult_board->get_active_board_y();
+    bool new_sub_game = !ult_board->is_sub_game_in_progress();
+    int board_x = ult_board->get_active_board_x();
+    int board_y = ult_board->get_active_board_y();
 
-        if (board_x == -1 || !ult_board->is_position_available(board_x, board_y)) {
-            display_main_board(ult_board);
+    if (new_sub_game && (board_x == -1 || !ult_board->is_position_available(board_x, board_y))) {
+        display_main_board(ult_board);
 
-            if (player->get_type() == PlayerType::HUMAN) {
-                cout << player->get_name() << " (" << player->get_symbol() << "), choose a board position:\n";
+        cout << player->get_name() << " (" << player->get_symbol() << "), choose a board position:\n";
 
-                cout << "Available positions: ";
-                for (int i = 0; i < 3; i++) {
-                    for (int j = 0; j < 3; j++) {
-                        if (ult_board->is_position_available(i, j)) {
-                            cout << "(" << i << "," << j << ") ";
-                        }
-                    }
+        cout << "Available positions: ";
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                if (ult_board->is_position_available(i, j)) {
+                    cout << "(" << i << "," << j << ") ";
                 }
-                cout << endl;
-
-                do {
-                    cout << "Enter board row (0-2): ";
-                    cin >> board_x;
-                    cout << "Enter board column (0-2): ";
-                    cin >> board_y;
-
-                    if (!ult_board->is_position_available(board_x, board_y)) {
-                        cout << "That position is already won! Choose another.\n";
-                    }
-                } while (!ult_board->is_position_available(board_x, board_y));
-            }
-            else {
-                do {
-                    board_x = rand() % 3;
-                    board_y = rand() % 3;
-                } while (!ult_board->is_position_available(board_x, board_y));
-
-                cout << "Computer " << player->get_name() << " chooses board ("
-                    << board_x << ", " << board_y << ")\n";
-                system("pause");
             }
         }
+        cout << endl;
 
-        ult_board->start_sub_game(board_x, board_y, player);
-    }
-
-    MiniBoard* mini_board = ult_board->get_current_mini_board();
+        do {
+            cout << "Enter board row (0-2): ";
+            cin >> board_x;
+            cout << "Enter board column (0-2): ";
+            cin >> board_y;
 
-    if (!mini_board) {
-        cerr << "Error: No active mini board!\n";
-        return new Move<char>(0, 0, player->get_symbol());
+            if (!ult_board->is_position_available(board_x, board_y)) {
+                cout << "That position is already won! Choose another.\n";
+            }
+        } while (!ult_board->is_position_available(board_x, board_y));
     }
 
-    int board_x = ult_board->get_active_board_x();
-    int board_y = ult_board->get_active_board_y();
-
     display_main_board(ult_board);
-    display_mini_board(mini_board, board_x, board_y);
-
-    int x, y;
-
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << player->get_name() << " (" << player->get_symbol() << "), make your move:\n";
-        cout << "Enter row (0-2): ";
-        cin >> x;
-        cout << "Enter column (0-2): ";
-        cin >> y;
+    if (new_sub_game) {
+        // The sub-game starts when the move is applied; until then show a fresh board
+        MiniBoard fresh;
+        display_mini_board(&fresh, board_x, board_y);
     }
     else {
-        auto matrix = mini_board->get_board_matrix();
-        do {
-            x = rand() % 3;
-            y = rand() % 3;
-        } while (matrix[x][y] != '.');
-
-        cout << "Computer plays at (" << x << ", " << y << ")\n";
-        system("pause");
+        display_mini_board(ult_board->get_current_mini_board(), board_x, board_y);
     }
 
-    return new Move<char>(x, y, player->get_symbol());
-}
\ No newline at end of file
+    int x, y;
+    cout << player->get_name() << " (" << player->get_symbol() << "), make your move:\n";
+    cout << "Enter row (0-2): ";
+    cin >> x;
+    cout << "Enter column (0-2): ";
+    cin >> y;
+
+    if (new_sub_game) {
+        return Move<char>(board_x, board_y, x, y, player->get_symbol());
+    }
+    return Move<char>(x, y, player->get_symbol());
+}
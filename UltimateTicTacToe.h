@@ -15,6 +15,7 @@
 #define ULTIMATE_TICTACTOE_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 
  /**
   * @class MiniBoard
@@ -32,9 +33,13 @@
   *
   * @see Board
   */
-class MiniBoard : public Board<char> {
+class MiniBoard final : public XOBoardBase {
+    // The meta-board restores a mini-board's cells when undoing a sub-game start
+    friend class UltimateTicTacToe_Board;
+
 private:
     char blank_symbol = '.'; ///< Character representing empty cells
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 
 public:
     /**
@@ -82,13 +87,37 @@ public:
      */
     bool game_is_over(Player<char>* player) override;
 
+    /**
+     * @brief Checks only the lines through the cell just filled.
+     *
+     * @param last_move The move just applied
+     * @return WIN for three in a row, DRAW if the mini-board is full, else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
     /**
      * @brief Resets mini-board to empty state.
      *
      * Clears all cells and resets move counter. Used when
      * starting a new sub-game.
      */
-    void reset();
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new MiniBoard(*this); }
+
+    /**
+     * @brief Lists every empty cell as a move for `symbol`.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 
     /**
      * @brief Determines the winner or draw state.
@@ -122,7 +151,7 @@ public:
  *
  * @see Board
  */
-class UltimateTicTacToe_Board : public Board<char> {
+class UltimateTicTacToe_Board final : public Board<char> {
 private:
     MiniBoard mini_board_X; ///< Mini-board used when X player is active
     MiniBoard mini_board_O; ///< Mini-board used when O player is active
@@ -131,12 +160,38 @@ private:
     int active_board_x;     ///< Row of currently active mini-board (-1 = any)
     int active_board_y;     ///< Column of currently active mini-board (-1 = any)
     bool first_move;        ///< True if no moves made yet
-    Player<char>* current_player; ///< Player currently playing mini-board
+    char current_symbol;    ///< Symbol of the player who started the sub-game (0 = none)
     bool sub_game_in_progress;    ///< True when mini-board game is active
 
     int last_cell_x;        ///< Row of last move in mini-board
     int last_cell_y;        ///< Column of last move in mini-board
 
+    /**
+     * @brief Meta-board state before an applied move, for undo_move().
+     *
+     * A move can start a sub-game (resetting a mini-board) and finish one
+     * (claiming a main-board position), so the small meta state and the
+     * touched mini-board are saved whole.
+     */
+    struct UndoEntry {
+        char main_board[3][3];
+        int active_board_x, active_board_y;
+        bool first_move;
+        char current_symbol;
+        bool sub_game_in_progress;
+        int last_cell_x, last_cell_y;
+        char mini_symbol;        ///< Which mini-board the move was played on
+        bool started;            ///< True if the move started a new sub-game
+        char mini_cells[3][3];   ///< Mini-board cells before a started sub-game reset them
+        int mini_moves;          ///< Mini-board move count before the reset
+        pair<int, int> mini_history[9]; ///< Mini-board history before the reset
+        int mini_history_size;   ///< Entries used in mini_history
+        uint64_t mini_hash;      ///< Mini-board hash before the reset
+        uint64_t mini_marks[2];  ///< Mini-board mark bitboards before the reset
+        uint64_t hash;           ///< Hash before the move
+    };
+    vector<UndoEntry> history; ///< Applied moves, oldest first
+
     /**
      * @brief Checks for three in a row on the main board.
      *
@@ -152,6 +207,39 @@ private:
      */
     bool is_main_board_full();
 
+    /**
+     * @brief Checks whether a new sub-game may start at a board position.
+     *
+     * The active board must be used if it is still open; otherwise any
+     * open position is allowed.
+     *
+     * @param board_x Row on main board
+     * @param board_y Column on main board
+     * @return true if the position may be chosen, false otherwise
+     */
+    bool can_start_sub_game(int board_x, int board_y) const;
+
+    /** @brief Copy the meta-board state into an undo entry. */
+    void save_state(UndoEntry& entry) const;
+
+    /** @brief Restore the meta-board state from an undo entry. */
+    void restore_state(const UndoEntry& entry);
+
+    /**
+     * @brief Hash keys of the state off the main board: the active
+     * position, whose sub-game is in progress and the first-move flag.
+     */
+    uint64_t meta_key() const {
+        int active = (active_board_x == -1) ? 9 : active_board_x * 3 + active_board_y;
+        int symbol = (current_symbol == 'X') ? 11 : (current_symbol == 'O' ? 12 : 10);
+        return zobrist.extra(active) ^ zobrist.extra(symbol) ^ (first_move ? zobrist.extra(13) : 0);
+    }
+
+    /** @brief Hash key index of a main-board result: X is 0, O is 1, a draw 2. */
+    static int result_piece(char result) {
+        return result == 'X' ? 0 : (result == 'O' ? 1 : 2);
+    }
+
 public:
     /**
      * @brief Constructs the Ultimate Tic-Tac-Toe board.
@@ -166,7 +254,9 @@ public:
      *
      * Routes move to appropriate mini-board (X or O) and checks
      * if mini-board is complete. If complete, records result on
-     * main board.
+     * main board. Between sub-games the move's origin names the
+     * board to start on; it may be left at (-1, -1) when the active
+     * board is forced.
      *
      * @param move Pointer to Move for mini-board position
      * @return true if move valid, false otherwise
@@ -208,6 +298,45 @@ public:
      */
     bool game_is_over(Player<char>* player) override;
 
+    /**
+     * @brief Checks the main board only when the move ended a sub-game.
+     *
+     * A move inside a sub-game that goes on leaves the main board as it
+     * was, so nothing is checked for it.
+     *
+     * @param last_move The move just applied
+     * @return WIN for 3 in a row on the main board, DRAW if it is full,
+     *         else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the meta-board, both mini-boards and the sub-game state.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new UltimateTicTacToe_Board(*this); }
+
+    /**
+     * @brief Lists the legal moves for `symbol`.
+     *
+     * During a sub-game these are the empty cells of the active mini-board.
+     * Between sub-games they are every cell of every board the player may
+     * start on, with the board position as the move's origin.
+     *
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board(),
+     * including any sub-game it started or finished.
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+
     /**
      * @brief Initiates a sub-game on specific board position.
      *
@@ -215,9 +344,9 @@ public:
      *
      * @param board_x Row on main board (0-2)
      * @param board_y Column on main board (0-2)
-     * @param player Pointer to player starting the sub-game
+     * @param symbol Symbol of the player starting the sub-game
      */
-    void start_sub_game(int board_x, int board_y, Player<char>* player);
+    void start_sub_game(int board_x, int board_y, char symbol);
 
     /**
      * @brief Ends current sub-game and updates active board.
@@ -314,7 +443,8 @@ public:
      *
      * @param name Player name
      * @param symbol Player symbol ('X' or 'O')
-     * @param type Player type (HUMAN or COMPUTER)
+     * @param type Player type. The registry gives AI players an
+     * MCTSEngine (see mcts_engine() in Main_Menu.cpp)
      * @return Pointer to new Player object
      */
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
@@ -328,9 +458,10 @@ public:
      * 3. Prompt for move within mini-board
      *
      * @param player Pointer to player making move
-     * @return Pointer to Move for mini-board position
+     * @return Move for mini-board position, with the chosen board as its
+     * origin when a new sub-game starts
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 
     /**
      * @brief Displays the 33 main board state.
@@ -0,0 +1,154 @@
+/**
+ * @file WinLines.h
+ * @brief Compile-time tables of the k-in-a-row lines of a board shape.
+ *
+ * This file provides:
+ * - `WinLines`: Every horizontal, vertical and diagonal line of K cells
+ *   on a Rows x Cols board, as bitmasks built by the compiler, plus the
+ *   lines through each cell.
+ * - `cell_mask`: Builds the optional mask of playable cells for shapes
+ *   that are not rectangles, such as the diamond and the pyramid.
+ *
+ * Cell (r, c) is bit r * Cols + c, the same numbering X/O boards keep
+ * their per-player mark bitboards in (see XOBoardBase::marks_of()). With
+ * those, "did this move win?" is a fixed number of AND/compare pairs
+ * instead of walks over coordinates.
+ */
+
+#ifndef WIN_LINES_H
+#define WIN_LINES_H
+
+#include <cstdint>
+#include <initializer_list>
+
+using namespace std;
+
+/**
+ * @brief Mask of the listed cells on a board `cols` wide.
+ * @param cells {row, col} pairs
+ */
+constexpr uint64_t cell_mask(int cols, initializer_list<initializer_list<int>> cells) {
+    uint64_t mask = 0;
+    for (const auto& cell : cells)
+        mask |= uint64_t(1) << (*cell.begin() * cols + *(cell.begin() + 1));
+    return mask;
+}
+
+/**
+ * @brief Mask of cell (r, c) for a line starting there in direction `dir`,
+ * or 0 if the line leaves the board or the playable cells.
+ *
+ * Directions: 0 along a row, 1 down a column, 2 down-right, 3 down-left.
+ */
+constexpr uint64_t win_line_mask(int rows, int cols, int k, uint64_t cells, int r, int c, int dir) {
+    const int dr = dir == 0 ? 0 : 1;
+    const int dc = dir == 1 ? 0 : (dir == 3 ? -1 : 1);
+    uint64_t mask = 0;
+    for (int i = 0; i < k; ++i) {
+        int rr = r + dr * i, cc = c + dc * i;
+        if (rr < 0 || rr >= rows || cc < 0 || cc >= cols) return 0;
+        uint64_t bit = uint64_t(1) << (rr * cols + cc);
+        if (!(cells & bit)) return 0;
+        mask |= bit;
+    }
+    return mask;
+}
+
+/**
+ * @brief Number of lines on the board, or through `cell` if it is not -1.
+ */
+constexpr int count_win_lines(int rows, int cols, int k, uint64_t cells, int cell = -1) {
+    int count = 0;
+    for (int r = 0; r < rows; ++r)
+        for (int c = 0; c < cols; ++c)
+            for (int dir = 0; dir < 4; ++dir) {
+                uint64_t line = win_line_mask(rows, cols, k, cells, r, c, dir);
+                if (line && (cell < 0 || (line >> cell & 1))) ++count;
+            }
+    return count;
+}
+
+/** @brief Most lines passing through any one cell. */
+constexpr int max_win_lines_through(int rows, int cols, int k, uint64_t cells) {
+    int most = 0;
+    for (int cell = 0; cell < rows * cols; ++cell) {
+        int n = count_win_lines(rows, cols, k, cells, cell);
+        if (n > most) most = n;
+    }
+    return most;
+}
+
+/**
+ * @class WinLines
+ * @brief The K-in-a-row lines of a board shape, generated at compile time.
+ *
+ * @tparam Rows, Cols Board size; at most 63 cells.
+ * @tparam K Marks in a row needed.
+ * @tparam Cells Mask of playable cells (default: all). Lines through any
+ * other cell are left out.
+ *
+ * Declare one as a `constexpr` object; the tables are then constants
+ * in the binary. Each cell's row of `through` is padded with a mask of
+ * all 64 bits, which no board fills, so the checks below run a fixed
+ * number of iterations with no branches on where the cell is.
+ */
+template <int Rows, int Cols, int K, uint64_t Cells = (uint64_t(1) << (Rows * Cols)) - 1>
+class WinLines {
+    static_assert(Rows * Cols < 64, "WinLines boards must fit in 63 bits");
+
+public:
+    static constexpr int COUNT = count_win_lines(Rows, Cols, K, Cells);         ///< Lines on the board
+    static constexpr int WIDTH = max_win_lines_through(Rows, Cols, K, Cells);   ///< Most lines through a cell
+    static constexpr uint64_t PADDING = ~uint64_t(0);                           ///< A line no position fills
+
+    uint64_t all[COUNT];                   ///< Every line
+    uint64_t through[Rows * Cols][WIDTH];  ///< Lines through each cell, padded with PADDING
+
+    constexpr WinLines() : all(), through() {
+        int n = 0;
+        int used[Rows * Cols] = {};
+        for (int cell = 0; cell < Rows * Cols; ++cell)
+            for (int i = 0; i < WIDTH; ++i) through[cell][i] = PADDING;
+
+        for (int r = 0; r < Rows; ++r)
+            for (int c = 0; c < Cols; ++c)
+                for (int dir = 0; dir < 4; ++dir) {
+                    uint64_t line = win_line_mask(Rows, Cols, K, Cells, r, c, dir);
+                    if (!line) continue;
+                    all[n++] = line;
+                    for (int cell = 0; cell < Rows * Cols; ++cell)
+                        if (line >> cell & 1) through[cell][used[cell]++] = line;
+                }
+    }
+
+    /** @brief Bit index of cell (r, c). */
+    static constexpr int cell(int r, int c) { return r * Cols + c; }
+
+    /** @brief Whether `marks` fills a line through cell (r, c). */
+    constexpr bool completes(int r, int c, uint64_t marks) const {
+        const uint64_t* lines = through[cell(r, c)];
+        bool won = false;
+        for (int i = 0; i < WIDTH; ++i)
+            won |= (marks & lines[i]) == lines[i];
+        return won;
+    }
+
+    /** @brief How many lines through cell (r, c) `marks` fills. */
+    constexpr int count_through(int r, int c, uint64_t marks) const {
+        const uint64_t* lines = through[cell(r, c)];
+        int count = 0;
+        for (int i = 0; i < WIDTH; ++i)
+            count += (marks & lines[i]) == lines[i];
+        return count;
+    }
+
+    /** @brief Whether `marks` fills any line on the board. */
+    constexpr bool any(uint64_t marks) const {
+        bool won = false;
+        for (int i = 0; i < COUNT; ++i)
+            won |= (marks & all[i]) == all[i];
+        return won;
+    }
+};
+
+#endif // WIN_LINES_H
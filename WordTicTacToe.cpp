@@ -8,10 +8,43 @@
 
 
 WordTicTacToe_Board::WordTicTacToe_Board() : Board<char>(3, 3) {
+    zobrist = ZobristKeys(rows, columns, 27);
 
     load_dic("dic.txt");
 }
 
+void WordTicTacToe_Board::reset() {
+    board.fill(blank_symbol);
+    n_moves = 0;
+    hash = 0;
+    history.clear();
+}
+
+void WordTicTacToe_Board::generate_moves(char, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                for (char letter = 'A'; letter <= 'Z'; ++letter)
+                    moves.add(Move<char>(i, j, letter));
+}
+
+bool WordTicTacToe_Board::random_move(char, RandomEngine& rng, Move<char>& move) {
+    int empty[9];
+    int count = 0;
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                empty[count++] = i * columns + j;
+    if (count == 0) return false;
+
+    // same order as generate_moves(): cells, then letters within a cell
+    int pick = rng.uniform(count * 26);
+    int cell = empty[pick / 26];
+    move = Move<char>(cell / columns, cell % columns, static_cast<char>('A' + pick % 26));
+    return true;
+}
+
 void WordTicTacToe_Board::load_dic(const string& filename)
 {
 
@@ -45,11 +78,24 @@ bool WordTicTacToe_Board::update_board(Move<char>* move) {
 
         n_moves++;
         board[x][y] = mark;
+        hash ^= zobrist.cell(x, y, letter_piece(mark)) ^ zobrist.side();
+        history.push_back({ x, y });
         return true;
     }
     return false;
 }
 
+bool WordTicTacToe_Board::undo_move() {
+    if (history.empty()) return false;
+
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash ^= zobrist.cell(cell.first, cell.second, letter_piece(board[cell.first][cell.second])) ^ zobrist.side();
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
+
 
 bool WordTicTacToe_Board::is_win(Player<char>* player) {
 
@@ -97,6 +143,28 @@ bool WordTicTacToe_Board::is_win(Player<char>* player) {
     return false;
 }
 
+bool WordTicTacToe_Board::line_is_word(int r, int c, int dr, int dc) const {
+    string word = "";
+    for (int k = 0; k < 3; ++k) {
+        char letter = board[r + k * dr][c + k * dc];
+        if (letter == blank_symbol) return false;
+        word += letter;
+    }
+    return dic.count(word) > 0;
+}
+
+Outcome WordTicTacToe_Board::evaluate_outcome(const Move<char>& last_move) {
+    int x = last_move.get_x();
+    int y = last_move.get_y();
+
+    if (line_is_word(x, 0, 0, 1) || line_is_word(0, y, 1, 0) ||
+        (x == y && line_is_word(0, 0, 1, 1)) ||
+        (x + y == 2 && line_is_word(0, 2, 1, -1)))
+        return Outcome::WIN;
+
+    return n_moves == 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
 bool WordTicTacToe_Board::is_draw(Player<char>* player) {
 
     return (n_moves == 9 && !is_win(player));
@@ -108,96 +176,65 @@ bool WordTicTacToe_Board::game_is_over(Player<char>* player) {
 }
 
 
+// WordTicTacToe_WinningLetterStrategy Implementation
+
+Move<char> WordTicTacToe_WinningLetterStrategy::choose_move(Board<char>& board, char symbol) {
+    MoveList<char> moves;
+    board.generate_moves(symbol, moves);
+
+    for (int i = 0; i < moves.size(); ++i) {
+        Move<char> move = moves[i];
+        board.update_board(&move);
+        bool wins = board.evaluate_outcome(move) == Outcome::WIN;
+        board.undo_move();
+        if (wins) return move;
+    }
+
+    Move<char> move;
+    board.random_move(symbol, rng, move);
+    return move;
+}
+
+
 // WordTicTacToe_UI Implementation
 
-WordTicTacToe_UI::WordTicTacToe_UI() : UI<char>("Welcome to Word Tic-Tac-Toe Game!", 3) {}
+WordTicTacToe_UI::WordTicTacToe_UI() : UI<char>("Welcome to Word Tic-Tac-Toe Game!", 3) {
+    type_options.push_back("MCTS AI");
+}
 
 
 Player<char>* WordTicTacToe_UI::create_player(string& name, char symbol, PlayerType type) {
-    return new Player<char>(name, symbol, type);
+    Player<char>* player = new Player<char>(name, symbol, type);
+    if (type == PlayerType::COMPUTER)
+        player->set_strategy(new WordTicTacToe_WinningLetterStrategy());
+    return player;
 }
 
-Move<char>* WordTicTacToe_UI::get_move(Player<char>* player) {
+Move<char> WordTicTacToe_UI::get_move(Player<char>* player) {
     int x, y;
     char letter;
 
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << player->get_name() << " (" << player->get_symbol() << " turn), enter letter: ";
-        cin >> letter;
-
-        while (cin.fail() || !isalpha(letter)) {
-            cin.clear();
-            cin.ignore(1000, '\n');
-            cout << "Invalid input. Enter a single letter: ";
-            cin >> letter;
-        }
+    cout << player->get_name() << " (" << player->get_symbol() << " turn), enter letter: ";
+    cin >> letter;
 
-        cout << "Enter position (row col 0-2): ";
-        cin >> x >> y;
-
-        while (cin.fail()) {
-            cin.clear();
-            cin.ignore(1000, '\n');
-            cout << "Invalid input. Enter row and column (0-2): ";
-            cin >> x >> y;
-        }
+    while (cin.fail() || !isalpha(letter)) {
+        cin.clear();
+        cin.ignore(1000, '\n');
+        cout << "Invalid input. Enter a single letter: ";
+        cin >> letter;
     }
-    else {
-        
-
-        WordTicTacToe_Board* current_board = (WordTicTacToe_Board*)player->get_board_ptr();
-        int best_x = -1, best_y = -1;
-        char best_letter = 0;
-        bool found_move = false;
-
-        
-        for (int i = 0; i < 3; ++i) {
-            for (int j = 0; j < 3; ++j) {
-                if (current_board->get_board_matrix()[i][j] == 0) {
-                    
-                    for (char c = 'A'; c <= 'Z'; ++c) {
-                        
-                        WordTicTacToe_Board temp_board = *current_board;
-                        Move<char> temp_move(i, j, c);
-                        
-                        temp_board.update_board(&temp_move);
-
-                        
-                        if (temp_board.is_win(player)) {
-                            best_x = i;
-                            best_y = j;
-                            best_letter = c;
-                            found_move = true;
-                            break; 
-                        }
-                    }
-                }
-                if (found_move) break; 
-            }
-            if (found_move) break; 
-        }
 
-        
-        if (found_move) {
-            x = best_x;
-            y = best_y;
-            letter = best_letter;
-        }
-        else {
-            
-            letter = 'A' + (rand() % 26);
-            
-            do {
-                x = rand() % 3;
-                y = rand() % 3;
-            } while (current_board->get_board_matrix()[x][y] != 0);
-        }
+    cout << "Enter position (row col 0-2): ";
+    cin >> x >> y;
 
-        cout << "Computer " << player->get_name() << " places '" << letter
-            << "' at (" << x << ", " << y << ")\n";
+    while (cin.fail()) {
+        cin.clear();
+        cin.ignore(1000, '\n');
+        cout << "Invalid input. Enter row and column (0-2): ";
+        cin >> x >> y;
     }
 
-    return new Move<char>(x, y, letter);
+    return Move<char>(x, y, letter);
 }
 
 
@@ -48,10 +48,11 @@ using namespace std;
  *
  * @see Board
  */
-class WordTicTacToe_Board : public Board<char> {
+class WordTicTacToe_Board final : public Board<char> {
 private:
     set<string> dic;        ///< Dictionary of valid 3-letter words (uppercase)
     char blank_symbol = 0;  ///< Value representing empty cells
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 
     /**
      * @brief Loads dictionary from text file.
@@ -71,6 +72,24 @@ private:
      */
     void load_dic(const string& filename);
 
+    /**
+     * @brief Checks if one full line of the board spells a dictionary word.
+     *
+     * @param r Row of the line's first cell
+     * @param c Column of the line's first cell
+     * @param dr Row step between cells
+     * @param dc Column step between cells
+     * @return true if all 3 cells hold letters and form a word, false otherwise
+     */
+    bool line_is_word(int r, int c, int dr, int dc) const;
+
+    /**
+     * @brief Hash key index of a letter: 'A'..'Z' are 0..25, anything else 26.
+     */
+    static int letter_piece(char letter) {
+        return (letter >= 'A' && letter <= 'Z') ? letter - 'A' : 26;
+    }
+
 public:
     /**
      * @brief Constructs a 3×3 word board and loads dictionary.
@@ -140,14 +159,80 @@ public:
      * @return true if word found or board full, false otherwise
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Checks only the lines through the cell just filled.
+     *
+     * Every other line was already checked when it was completed, so
+     * only the row, column and diagonals through the new letter can
+     * have become a word.
+     *
+     * @param last_move The move just applied
+     * @return WIN if a word was formed, DRAW if the board is full, else ONGOING
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Clears all letters from the board.
+     *
+     * The loaded dictionary is kept.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new WordTicTacToe_Board(*this); }
+
+    /**
+     * @brief Lists every letter A-Z on every empty cell.
+     * @param symbol Ignored; both players may place any letter.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Picks a random empty cell and letter with one draw, without
+     * listing all 26 letters of every cell. Makes the same choice as
+     * picking from generate_moves() with the same draw.
+     */
+    bool random_move(char symbol, RandomEngine& rng, Move<char>& move) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
+};
+
+/**
+ * @class WordTicTacToe_WinningLetterStrategy
+ * @brief The Word Tic-Tac-Toe "Computer" player: completes a word when
+ * it can, and otherwise plays a random letter on a random cell.
+ *
+ * Winning moves are looked for in generate_moves() order (cells row by
+ * row, then letters A-Z), trying each with update_board()/undo_move().
+ *
+ * @see MoveStrategy
+ */
+class WordTicTacToe_WinningLetterStrategy : public MoveStrategy<char> {
+    RandomEngine rng; ///< Source of the random moves
+
+public:
+    /**
+     * @brief Picks the first winning move, or a random one if none wins.
+     *
+     * @return The chosen move, or an empty Move if the board is full
+     */
+    Move<char> choose_move(Board<char>& board, char symbol) override;
+
+    void seed(uint64_t s) override { rng.seed(s); }
 };
 
 /**
  * @class WordTicTacToe_UI
  * @brief User interface for Word Tic-Tac-Toe.
  *
- * Provides player setup, move input (letter + position), and
- * intelligent AI that attempts to form winning words.
+ * Provides player setup and move input (letter + position) for human
+ * players. Computer players use WordTicTacToe_WinningLetterStrategy.
  *
  * @see UI
  */
@@ -168,41 +253,24 @@ public:
      *
      * @param name Player name
      * @param symbol Player identifier (used for turn tracking)
-     * @param type Player type (HUMAN or COMPUTER)
+     * @param type Player type; COMPUTER players use
+     * WordTicTacToe_WinningLetterStrategy. The registry gives AI players an
+     * MCTSEngine (see mcts_engine() in Main_Menu.cpp)
      * @return Pointer to new Player object
      */
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     /**
-     * @brief Gets a letter and position from player.
+     * @brief Gets a letter and position from a human player.
      *
-     * For human players:
      * - Prompts for letter (A-Z)
      * - Validates input is alphabetic
      * - Prompts for position (row, col 0-2)
      *
-     * For computer players:
-     * - Uses intelligent strategy to find winning moves:
-     *   1. Try all empty positions
-     *   2. For each position, try all 26 letters
-     *   3. Check if placement creates winning word
-     *   4. If winning move found, use it
-     *   5. Otherwise, random letter and position
-     *
-     * AI strategy:
-     * @code
-     * for each empty cell:
-     *     for each letter A-Z:
-     *         simulate placing letter
-     *         if forms valid word:
-     *             return this move
-     * return random move
-     * @endcode
-     *
      * @param player Pointer to player making move
-     * @return Pointer to Move with position and letter
+     * @return Move with position and letter
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 
     /**
      * @brief Sets up both players with explanation.
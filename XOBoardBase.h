@@ -0,0 +1,61 @@
+/**
+ * @file XOBoardBase.h
+ * @brief Mark bitboards for boards whose two players play 'X' and 'O'.
+ *
+ * This file provides:
+ * - `XOBoardBase`: A Board<char> that also keeps one bitboard per player,
+ *   for checking lines against a WinLines table, and hashes X/O moves.
+ *
+ * Only boards with an X/O alphabet derive from it. Boards whose cells hold
+ * numbers or letters (Numerical, SUS, Word) derive from Board directly.
+ */
+
+#ifndef XO_BOARD_BASE_H
+#define XO_BOARD_BASE_H
+
+#include <cstdint>
+#include "BoardGame_Classes.h"
+
+using namespace std;
+
+/**
+ * @class XOBoardBase
+ * @brief Board<char> with per-player mark bitboards for 'X' and 'O'.
+ *
+ * Cell (x, y) is bit x * columns + y, the numbering WinLines uses, so only
+ * boards of at most 63 cells derive from it. 'X' is player 0 and any other
+ * mark player 1.
+ */
+class XOBoardBase : public Board<char> {
+protected:
+    uint64_t marks[2] = { 0, 0 }; ///< Cells holding 'X' (0) and 'O' (1); see marks_of()
+
+    /** @brief Construct a rows x columns board with no marks. */
+    XOBoardBase(int rows, int columns) : Board<char>(rows, columns) {}
+
+    /** @brief Toggle a mark in cell (x, y) in the mark bitboards. */
+    void toggle_mark(int x, int y, char mark) {
+        marks[mark == 'X' ? 0 : 1] ^= uint64_t(1) << (x * columns + y);
+    }
+
+    /**
+     * @brief Toggle a mark in cell (x, y), in the hash (with the side to
+     * move) and in the mark bitboards.
+     *
+     * The board's Zobrist keys must be sized for 2 pieces: 'X' is piece 0
+     * and any other mark piece 1. update_board() and undo_move() each call
+     * it once for the cell they change.
+     */
+    void hash_xo_move(int x, int y, char mark) {
+        hash ^= zobrist.cell(x, y, mark == 'X' ? 0 : 1) ^ zobrist.side();
+        toggle_mark(x, y, mark);
+    }
+
+    /**
+     * @brief Bitboard of the cells holding `mark`, for checking lines
+     * against a WinLines table.
+     */
+    uint64_t marks_of(char mark) const { return marks[mark == 'X' ? 0 : 1]; }
+};
+
+#endif // XO_BOARD_BASE_H
@@ -4,16 +4,36 @@
 #include <iomanip>
 #include <cctype>  // for toupper()
 #include "XO_Classes.h"
+#include "WinLines.h"
+#include "NineCellTable.h"
 
 using namespace std;
 
+// Rows, columns and diagonals of the 3x3 board, as masks over marks_of()
+static constexpr WinLines<3, 3, 3> xo_lines;
+
 //--------------------------------------- X_O_Board Implementation
 
-X_O_Board::X_O_Board() : Board(3, 3) {
+X_O_Board::X_O_Board() : XOBoardBase(3, 3) {
+    zobrist = ZobristKeys(rows, columns, 2);
+    reset();
+}
+
+void X_O_Board::reset() {
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    board.fill(blank_symbol);
+    history.clear();
+    n_moves = 0;
+    hash = 0;
+    marks[0] = marks[1] = 0;
+}
+
+void X_O_Board::generate_moves(char symbol, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < columns; ++j)
+            if (board[i][j] == blank_symbol)
+                moves.add(Move<char>(i, j, symbol));
 }
 
 bool X_O_Board::update_board(Move<char>* move) {
@@ -23,41 +43,30 @@ bool X_O_Board::update_board(Move<char>* move) {
 
     // Validate move and apply if valid
     if (!(x < 0 || x >= rows || y < 0 || y >= columns) &&
-        (board[x][y] == blank_symbol || mark == 0)) {
-
-        if (mark == 0) { // Undo move
-            n_moves--;
-            board[x][y] = blank_symbol;
-        }
-        else {         // Apply move
-            n_moves++;
-            board[x][y] = toupper(mark);
-        }
+        (board[x][y] == blank_symbol)) {
+
+        n_moves++;
+        board[x][y] = toupper(mark);
+        hash_xo_move(x, y, board[x][y]);
+        history.push_back({ x, y });
         return true;
     }
     return false;
 }
 
-bool X_O_Board::is_win(Player<char>* player) {
-    const char sym = player->get_symbol();
-
-    auto all_equal = [&](char a, char b, char c) {
-        return a == b && b == c && a != blank_symbol;
-        };
-
-    // Check rows and columns
-    for (int i = 0; i < rows; ++i) {
-        if ((all_equal(board[i][0], board[i][1], board[i][2]) && board[i][0] == sym) ||
-            (all_equal(board[0][i], board[1][i], board[2][i]) && board[0][i] == sym))
-            return true;
-    }
+bool X_O_Board::undo_move() {
+    if (history.empty()) return false;
 
-    // Check diagonals
-    if ((all_equal(board[0][0], board[1][1], board[2][2]) && board[1][1] == sym) ||
-        (all_equal(board[0][2], board[1][1], board[2][0]) && board[1][1] == sym))
-        return true;
+    pair<int, int> cell = history.back();
+    history.pop_back();
+    hash_xo_move(cell.first, cell.second, board[cell.first][cell.second]);
+    board[cell.first][cell.second] = blank_symbol;
+    n_moves--;
+    return true;
+}
 
-    return false;
+bool X_O_Board::is_win(Player<char>* player) {
+    return xo_lines.any(marks_of(player->get_symbol()));
 }
 
 bool X_O_Board::is_draw(Player<char>* player) {
@@ -68,6 +77,18 @@ bool X_O_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+Outcome X_O_Board::evaluate_outcome(const Move<char>& last_move) {
+    const int x = last_move.get_x(), y = last_move.get_y();
+    if (xo_lines.completes(x, y, marks_of(board[x][y])))
+        return Outcome::WIN;
+    return n_moves == 9 ? Outcome::DRAW : Outcome::ONGOING;
+}
+
+bool X_O_Board::perfect_move(char symbol, Move<char>& move) const {
+    static const NineCellTable table(xo_lines.all, xo_lines.COUNT, 0x1FF, Outcome::WIN, Outcome::DRAW);
+    return table.best_move(marks[0], marks[1], symbol, columns, move);
+}
+
 //--------------------------------------- XO_UI Implementation
 
 XO_UI::XO_UI() : UI<char>("Weclome to FCAI X-O Game by Dr El-Ramly", 3) {}
@@ -80,16 +101,10 @@ Player<char>* XO_UI::create_player(string& name, char symbol, PlayerType type) {
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* XO_UI::get_move(Player<char>* player) {
+Move<char> XO_UI::get_move(Player<char>* player) {
     int x, y;
     
-    if (player->get_type() == PlayerType::HUMAN) {
-        cout << "\nPlease enter your move x and y (0 to 2): ";
-        cin >> x >> y;
-    }
-    else if (player->get_type() == PlayerType::COMPUTER) {
-        x = rand() % player->get_board_ptr()->get_rows();
-        y = rand() % player->get_board_ptr()->get_columns();
-    }
-    return new Move<char>(x, y, player->get_symbol());
+    cout << "\nPlease enter your move x and y (0 to 2): ";
+    cin >> x >> y;
+    return Move<char>(x, y, player->get_symbol());
 }
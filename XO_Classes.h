@@ -11,6 +11,7 @@
 #define XO_CLASSES_H
 
 #include "BoardGame_Classes.h"
+#include "XOBoardBase.h"
 using namespace std;
 
 /**
@@ -23,9 +24,10 @@ using namespace std;
  *
  * @see Board
  */
-class X_O_Board : public Board<char> {
+class X_O_Board final : public XOBoardBase {
 private:
     char blank_symbol = '.'; ///< Character used to represent an empty cell on the board.
+    vector<pair<int, int>> history; ///< Cells filled by applied moves, oldest first (for undo_move)
 
 public:
     /**
@@ -67,6 +69,37 @@ public:
      * @return true if the game has ended, false otherwise.
      */
     bool game_is_over(Player<char>* player);
+
+    /**
+     * @brief Checks only the lines through the cell `last_move` filled.
+     * @param last_move The move just applied.
+     * @return WIN for three in a row, DRAW once all 9 cells are filled, else ONGOING.
+     */
+    Outcome evaluate_outcome(const Move<char>& last_move) override;
+
+    /**
+     * @brief Resets the board to all blank cells.
+     */
+    void reset() override;
+
+    /** @brief Copy of this board, including its undo history. */
+    Board<char>* clone() const override { return new X_O_Board(*this); }
+
+    /** @brief The perfect-play move for `symbol`, looked up in a table of every position. */
+    bool perfect_move(char symbol, Move<char>& move) const override;
+
+    /**
+     * @brief Lists every empty cell as a move for `symbol`.
+     * @param symbol Symbol of the player to move.
+     * @param moves Receives the moves; cleared first.
+     */
+    void generate_moves(char symbol, MoveList<char>& moves) override;
+
+    /**
+     * @brief Takes back the last move applied by update_board().
+     * @return true if a move was undone, false if there was none.
+     */
+    bool undo_move() override;
 };
 
 
@@ -105,9 +138,9 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      * @param player Pointer to the player whose move is being requested.
-     * @return A pointer to a new `Move<char>` object representing the player's action.
+     * @return A `Move<char>` value representing the player's action.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 };
 
 #endif // XO_CLASSES_H
@@ -0,0 +1,105 @@
+/**
+ * @file lazy_smp_bench.cpp
+ * @brief Measures how much faster NegamaxEngine reaches a fixed depth with
+ * Lazy SMP helper threads than with the calling thread alone.
+ *
+ * For each deterministic game, a few positions are set up by playing
+ * seeded random openings. Each position is searched to a fixed depth a
+ * few plies beyond that game's "Search AI" in the menu, so a search takes
+ * long enough to time, once with a single thread and once with N threads,
+ * by fresh engines so neither starts with a warm table. The report gives
+ * both times, the nodes visited and the speedup (single-thread time /
+ * N-thread time).
+ *
+ * Build and run from the repository root:
+ * @code
+ * g++ -std=c++17 -O2 -pthread -I. bench/lazy_smp_bench.cpp FourInARow.cpp \
+ *     Diamond_Tic_Tac_Toe.cpp TicTacToe5x5.cpp Obstacles_Tic_Tac_Toe.cpp -o lazy_smp_bench
+ * ./lazy_smp_bench [threads] [positions]
+ * @endcode
+ * threads defaults to the number of hardware threads and positions to 4.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+
+#include "FourInARow.h"
+#include "Diamond_Tic_Tac_Toe.h"
+#include "TicTacToe5x5.h"
+#include "Obstacles_Tic_Tac_Toe.h"
+#include "NegamaxEngine.h"
+
+using namespace std;
+
+/**
+ * @brief Seconds and nodes one engine needs to search `board` for `symbol`.
+ */
+template <typename B>
+double time_search(B& board, char symbol, int depth, int threads, long& nodes) {
+    NegamaxEngine<char, B> engine(depth, 16, threads);
+    auto start = chrono::steady_clock::now();
+    engine.choose_move(board, symbol);
+    nodes = engine.get_nodes();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Search `positions` openings of game B with 1 and with `threads`
+ * threads and print one line per position plus the total.
+ *
+ * @param opening Random moves played from the start to reach each position
+ * (position p uses p * opening moves, so the first is the empty board).
+ */
+template <typename B>
+void bench_game(const string& name, int depth, int opening, int threads, int positions) {
+    SilentOutput silent;
+    double total_single = 0, total_parallel = 0;
+
+    for (int p = 0; p < positions; ++p) {
+        B board;
+        board.seed(RandomEngine::derive(0xBE7C4, p));
+        RandomEngine random(RandomEngine::derive(0x09E4, p));
+        char side = 'X';
+        for (int m = 0; m < p * opening; ++m) {
+            Move<char> move;
+            if (!board.random_move(side, random, move) || !board.update_board(&move)) break;
+            if (board.evaluate_outcome(move) != Outcome::ONGOING) {
+                board.undo_move();
+                break;
+            }
+            side = board.other_symbol(side);
+        }
+
+        long single_nodes = 0, parallel_nodes = 0;
+        double single = time_search(board, side, depth, 1, single_nodes);
+        double parallel = time_search(board, side, depth, threads, parallel_nodes);
+        total_single += single;
+        total_parallel += parallel;
+
+        cerr << left << setw(12) << name << " pos " << p << right
+             << "  1 thread " << setw(9) << fixed << setprecision(1) << single * 1000 << " ms "
+             << setw(10) << single_nodes << " nodes"
+             << "  " << threads << " threads " << setw(9) << parallel * 1000 << " ms "
+             << setw(10) << parallel_nodes << " nodes"
+             << "  speedup " << setprecision(2) << single / parallel << "\n";
+    }
+    cerr << left << setw(12) << name << " total" << right
+         << "  depth " << depth << "  speedup " << fixed << setprecision(2)
+         << total_single / total_parallel << "\n\n";
+}
+
+int main(int argc, char* argv[]) {
+    int threads = argc > 1 ? atoi(argv[1]) : static_cast<int>(thread::hardware_concurrency());
+    int positions = argc > 2 ? atoi(argv[2]) : 4;
+    threads = max(1, threads);
+    positions = max(1, positions);
+
+    cerr << "Lazy SMP: 1 thread vs " << threads << " threads, time to fixed depth\n\n";
+    bench_game<FourInARow_Board>("FourInARow", 14, 4, threads, positions);
+    bench_game<Diamond_Tic_Tac_Toe_Board>("Diamond", 9, 4, threads, positions);
+    bench_game<TicTacToe5x5>("5x5", 9, 3, threads, positions);
+    bench_game<Obstacles_Tic_Tac_Toe_Board>("Obstacles", 8, 3, threads, positions);
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * @file micro_bench.cpp
+ * @brief Nanoseconds and heap allocations per call of the hot board
+ * operations of every game, as JSON.
+ *
+ * For each game a corpus of mid-game positions is built from a seed:
+ * position i replays the first half of a random game seeded from
+ * RandomEngine::derive(seed, i). On every position the bench times
+ *
+ * - `update_board`: one random legal move (taken back with undo_move()
+ *   outside the timed region),
+ * - `is_win` and `is_draw`: for the player who just moved,
+ * - `choose_move`: the move of a "Computer" player, as GameManager asks
+ *   its strategy for it,
+ *
+ * in rounds over the whole corpus until each has run for a while.
+ * Allocations are counted by replacing the global operator new and
+ * new[]. The same seed always gives the same corpus, so two runs of
+ * different builds can be compared entry by entry.
+ *
+ * Build and run from the repository root:
+ * @code
+ * g++ -std=c++17 -O2 -pthread -I. bench/micro_bench.cpp XO_Classes.cpp FourInARow.cpp \
+ *     SUS_Classes.cpp TicTacToe5x5.cpp WordTicTacToe.cpp Misere_Tic_Tac_Toe.cpp \
+ *     Diamond_Tic_Tac_Toe.cpp Tic_Tac_Toe_4x4.cpp Pyramid_Tic_Tac_Toe.cpp \
+ *     Numerical_tic_tac_9.cpp Obstacles_Tic_Tac_Toe.cpp Infinity_TicTacToe.cpp \
+ *     UltimateTicTacToe.cpp MemoryTTT_Classes.cpp -o micro_bench
+ * ./micro_bench [positions] [seed] > before.json
+ * @endcode
+ * positions defaults to 64 per game and seed to 1. The JSON goes to cout;
+ * nothing else is printed there.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <new>
+
+#include "XO_Classes.h"
+#include "FourInARow.h"
+#include "SUS_Classes.h"
+#include "TicTacToe5x5.h"
+#include "WordTicTacToe.h"
+#include "Misere_Tic_Tac_Toe.h"
+#include "Diamond_Tic_Tac_Toe.h"
+#include "Tic_Tac_Toe_4x4.h"
+#include "Pyramid_Tic_Tac_Toe.h"
+#include "Numerical_tic_tac_9.h"
+#include "Obstacles_Tic_Tac_Toe.h"
+#include "Infinity_TicTacToe.h"
+#include "UltimateTicTacToe.h"
+#include "MemoryTTT_Classes.h"
+
+using namespace std;
+
+static long allocations = 0; ///< operator new calls so far; the bench is single-threaded
+
+/**
+ * @brief free() behind a call the compiler cannot see through, so it does
+ * not pair the free() with the operator new of the delete-expression and
+ * warn about a mismatch.
+ */
+__attribute__((noinline)) static void release(void* p) noexcept { free(p); }
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { release(p); }
+void operator delete(void* p, size_t) noexcept { release(p); }
+void operator delete[](void* p) noexcept { release(p); }
+void operator delete[](void* p, size_t) noexcept { release(p); }
+
+static const double MIN_SECONDS = 0.05; ///< Timed run of each operation per game
+static volatile long sink = 0;          ///< Keeps results of the timed calls alive
+
+/**
+ * @brief One line of the report.
+ */
+struct Measurement {
+    string game;
+    string op;
+    long calls;
+    double ns_per_op;
+    double allocs_per_op;
+};
+
+/**
+ * @brief A corpus position: its board, whose turn it is and a legal move
+ * for that player.
+ */
+template <typename T>
+struct Position {
+    Board<T>* board;
+    Player<T>* players[2]; ///< Computer players bound to this board
+    int to_move;           ///< Index into players of the side to move
+    Move<T> move;          ///< A random legal move of the side to move
+    bool applied;          ///< Whether the timed update_board() took the move
+};
+
+/**
+ * @brief Seed `board` from `s` and play up to `plies` random moves on it.
+ * @return The number of moves played; fewer than `plies` if the game ended.
+ */
+template <typename T>
+int play_random(Board<T>& board, const T (&symbols)[2], uint64_t s, int plies) {
+    board.seed(RandomEngine::derive(s, 0));
+    board.reset();
+    RandomEngine rng(RandomEngine::derive(s, 1));
+    int ply = 0;
+    Move<T> move;
+    while (ply < plies && board.random_move(symbols[ply % 2], rng, move)) {
+        board.update_board(&move);
+        ++ply;
+        if (board.evaluate_outcome(move) != Outcome::ONGOING) break;
+    }
+    return ply;
+}
+
+/**
+ * @brief Run `timed` (one call per position) in rounds until MIN_SECONDS
+ * have been timed, calling the untimed `restore` after each round.
+ */
+template <typename Timed, typename Restore>
+Measurement measure(const string& game, const string& op, int positions, Timed timed, Restore restore) {
+    timed();
+    restore();
+    long rounds = 0, allocated = 0;
+    double seconds = 0;
+    while (seconds < MIN_SECONDS) {
+        const long before = allocations;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        timed();
+        seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        allocated += allocations - before;
+        restore();
+        ++rounds;
+    }
+    const long calls = rounds * positions;
+    return { game, op, calls, seconds * 1e9 / calls, static_cast<double>(allocated) / calls };
+}
+
+/**
+ * @brief Build the corpus of game B and measure its four operations.
+ */
+template <typename T, typename B, typename U>
+void bench_game(const string& game, T first, T second, int n_positions, uint64_t seed,
+                vector<Measurement>& results) {
+    SilentOutput silence; // constructors and create_player() print
+    const T symbols[2] = { first, second };
+    U ui;
+    B probe;
+    vector<Position<T>> corpus;
+
+    for (int i = 0; i < n_positions; ++i) {
+        const uint64_t s = RandomEngine::derive(seed, i);
+        const int length = play_random<T>(probe, symbols, s, 1 << 20);
+        Position<T> p;
+        p.board = new B();
+        p.to_move = play_random<T>(*p.board, symbols, s, length / 2) % 2;
+        RandomEngine rng(RandomEngine::derive(s, 2));
+        if (!p.board->random_move(symbols[p.to_move], rng, p.move)) {
+            delete p.board;
+            continue;
+        }
+        for (int k : {0, 1}) {
+            string name = k == 0 ? "Player 1" : "Player 2";
+            p.players[k] = ui.create_player(name, symbols[k], PlayerType::COMPUTER);
+            p.players[k]->set_board_ptr(p.board);
+            p.players[k]->seed(RandomEngine::derive(s, 3 + k));
+        }
+        corpus.push_back(p);
+    }
+    const int n = static_cast<int>(corpus.size());
+    auto nothing = []() {};
+
+    results.push_back(measure(game, "update_board", n, [&]() {
+        for (Position<T>& p : corpus) {
+            Move<T> move = p.move;
+            p.applied = p.board->update_board(&move);
+        }
+    }, [&]() {
+        for (Position<T>& p : corpus)
+            if (p.applied) p.board->undo_move();
+    }));
+    results.push_back(measure(game, "is_win", n, [&]() {
+        for (Position<T>& p : corpus) sink += p.board->is_win(p.players[1 - p.to_move]);
+    }, nothing));
+    results.push_back(measure(game, "is_draw", n, [&]() {
+        for (Position<T>& p : corpus) sink += p.board->is_draw(p.players[1 - p.to_move]);
+    }, nothing));
+    results.push_back(measure(game, "choose_move", n, [&]() {
+        for (Position<T>& p : corpus) sink += p.players[p.to_move]->choose_move().get_x();
+    }, nothing));
+
+    for (Position<T>& p : corpus) {
+        delete p.players[0];
+        delete p.players[1];
+        delete p.board;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int positions = argc > 1 ? max(1, atoi(argv[1])) : 64;
+    const uint64_t seed = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1;
+
+    vector<Measurement> results;
+    bench_game<char, X_O_Board, XO_UI>("xo", 'X', 'O', positions, seed, results);
+    bench_game<char, FourInARow_Board, FourInARow_UI>("four-in-a-row", 'X', 'O', positions, seed, results);
+    bench_game<char, SUS_Board, SUS_UI>("sus", 'S', 'U', positions, seed, results);
+    bench_game<char, TicTacToe5x5, TicTacToe5x5_UI>("5x5", 'X', 'O', positions, seed, results);
+    bench_game<char, WordTicTacToe_Board, WordTicTacToe_UI>("word", 'X', 'O', positions, seed, results);
+    bench_game<char, Misere_Tic_Tac_Toe_Board, Misere_Tic_Tac_Toe_UI>("misere", 'X', 'O', positions, seed, results);
+    bench_game<char, Diamond_Tic_Tac_Toe_Board, Diamond_Tic_Tac_Toe_UI>("diamond", 'X', 'O', positions, seed, results);
+    bench_game<char, Tic_Tac_Toe_4x4_Board, Tic_Tac_Toe_4x4_UI>("4x4", 'X', 'O', positions, seed, results);
+    bench_game<char, Pyramid_Tic_Tac_Toe_Board, Pyramid_Tic_Tac_Toe_UI>("pyramid", 'X', 'O', positions, seed, results);
+    bench_game<int, Numerical_Board, Numerical_UI>("numerical", 1, 2, positions, seed, results);
+    bench_game<char, Obstacles_Tic_Tac_Toe_Board, Obstacles_Tic_Tac_Toe_UI>("obstacles", 'X', 'O', positions, seed, results);
+    bench_game<char, Infinity_Board, Infinity_UI>("infinity", 'X', 'O', positions, seed, results);
+    bench_game<char, UltimateTicTacToe_Board, UltimateTicTacToe_UI>("ultimate", 'X', 'O', positions, seed, results);
+    bench_game<char, MemoryTTT_Board, MemoryTTT_UI>("memory", 'X', 'O', positions, seed, results);
+
+    cout << "{\n  \"seed\": " << seed << ",\n  \"positions\": " << positions << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Measurement& m = results[i];
+        cout << "    {\"game\": \"" << m.game << "\", \"op\": \"" << m.op << "\", \"calls\": " << m.calls
+             << fixed << setprecision(2) << ", \"ns_per_op\": " << m.ns_per_op
+             << setprecision(4) << ", \"allocs_per_op\": " << m.allocs_per_op << "}"
+             << (i + 1 < results.size() ? "," : "") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+    cout << "  ]\n}\n";
+    return 0;
+}
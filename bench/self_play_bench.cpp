@@ -0,0 +1,93 @@
+/**
+ * @file self_play_bench.cpp
+ * @brief Compares GameManager's virtual game loop with the statically
+ * dispatched self_play() loop on random self-play.
+ *
+ * For each game, the same seeded batch is played twice with two random
+ * players: once through GameManager::run_batch() with the game's UI and
+ * two "Computer" players, as the menu would, and once through
+ * self_play_batch() with two RandomPolicy players. Both paths seed alike,
+ * so they must play the same games; the report checks that and gives the
+ * games per second of each path and the speedup.
+ *
+ * Build and run from the repository root:
+ * @code
+ * g++ -std=c++17 -O2 -pthread -I. bench/self_play_bench.cpp XO_Classes.cpp \
+ *     Misere_Tic_Tac_Toe.cpp Pyramid_Tic_Tac_Toe.cpp Tic_Tac_Toe_4x4.cpp \
+ *     FourInARow.cpp Obstacles_Tic_Tac_Toe.cpp -o self_play_bench
+ * ./self_play_bench [games]
+ * @endcode
+ * games defaults to 200000 per game.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+#include "XO_Classes.h"
+#include "Misere_Tic_Tac_Toe.h"
+#include "Pyramid_Tic_Tac_Toe.h"
+#include "Tic_Tac_Toe_4x4.h"
+#include "FourInARow.h"
+#include "Obstacles_Tic_Tac_Toe.h"
+#include "SelfPlay.h"
+
+using namespace std;
+
+/**
+ * @brief Play `games` random games of B both ways and print one line.
+ */
+template <typename B, typename GameUI>
+void bench_game(const string& name, int games) {
+    const uint64_t seed = 0x5E1F;
+    vector<GameResult> virtual_results, static_results;
+    double virtual_seconds = 0, static_seconds = 0;
+
+    {
+        SilentOutput silent; // UI constructors print their welcome text
+        GameUI ui;
+        B board;
+        Player<char>* players[2] = {
+            new Player<char>("A", 'X', PlayerType::COMPUTER),
+            new Player<char>("B", 'O', PlayerType::COMPUTER)
+        };
+        GameManager<char> manager(&board, players, &ui);
+        auto start = chrono::steady_clock::now();
+        virtual_results = manager.run_batch(games, seed);
+        virtual_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        delete players[0];
+        delete players[1];
+    }
+    {
+        B board;
+        RandomPolicy first, second;
+        auto start = chrono::steady_clock::now();
+        static_results = self_play_batch(board, first, second, 'X', 'O', games, seed);
+        static_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    int mismatches = 0;
+    for (int g = 0; g < games; ++g)
+        mismatches += virtual_results[g].winner != static_results[g].winner ||
+                      virtual_results[g].moves != static_results[g].moves;
+
+    cerr << left << setw(10) << name << right << fixed << setprecision(0)
+         << "  GameManager " << setw(9) << games / virtual_seconds << " games/s"
+         << "  self_play " << setw(9) << games / static_seconds << " games/s"
+         << "  speedup " << setprecision(2) << virtual_seconds / static_seconds
+         << "  mismatched games " << mismatches << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    int games = argc > 1 ? atoi(argv[1]) : 200000;
+    games = max(1, games);
+
+    cerr << "Random self-play, " << games << " games each: virtual loop vs static loop\n\n";
+    bench_game<X_O_Board, XO_UI>("X-O", games);
+    bench_game<Misere_Tic_Tac_Toe_Board, Misere_Tic_Tac_Toe_UI>("Misere", games);
+    bench_game<Pyramid_Tic_Tac_Toe_Board, Pyramid_Tic_Tac_Toe_UI>("Pyramid", games);
+    bench_game<Tic_Tac_Toe_4x4_Board, Tic_Tac_Toe_4x4_UI>("4x4", games);
+    bench_game<FourInARow_Board, FourInARow_UI>("FourInARow", games);
+    bench_game<Obstacles_Tic_Tac_Toe_Board, Obstacles_Tic_Tac_Toe_UI>("Obstacles", games);
+    return 0;
+}